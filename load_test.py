@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""HTTP load harness for the ESP32-CAM firmware.
+
+Drives concurrent requests against a device and reports latency
+percentiles and throughput, so hot-path regressions show up in a
+before/after run instead of in the field. Companion to the on-device
+GET /benchmark suite.
+
+Examples:
+    python3 load_test.py 192.168.50.3
+    python3 load_test.py 192.168.50.3 --path /snap --workers 4 --duration 30
+    python3 load_test.py 192.168.50.3 --path /status --workers 2
+"""
+
+import argparse
+import sys
+import threading
+import time
+import urllib.error
+import urllib.request
+
+
+class Worker(threading.Thread):
+    def __init__(self, url, deadline, timeout):
+        super().__init__(daemon=True)
+        self.url = url
+        self.deadline = deadline
+        self.timeout = timeout
+        self.latencies = []
+        self.errors = 0
+        self.bytes_received = 0
+
+    def run(self):
+        while time.time() < self.deadline:
+            start = time.time()
+            try:
+                with urllib.request.urlopen(self.url, timeout=self.timeout) as resp:
+                    body = resp.read()
+                    self.bytes_received += len(body)
+                self.latencies.append((time.time() - start) * 1000.0)
+            except (urllib.error.URLError, OSError):
+                self.errors += 1
+
+
+def percentile(sorted_values, pct):
+    if not sorted_values:
+        return 0.0
+    index = min(int(len(sorted_values) * pct / 100.0), len(sorted_values) - 1)
+    return sorted_values[index]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("host", help="Device IP or hostname")
+    parser.add_argument("--path", default="/snap",
+                        help="Endpoint to load (default /snap)")
+    parser.add_argument("--workers", type=int, default=4,
+                        help="Concurrent connections (default 4)")
+    parser.add_argument("--duration", type=int, default=15,
+                        help="Test duration in seconds (default 15)")
+    parser.add_argument("--timeout", type=float, default=10.0,
+                        help="Per-request timeout in seconds (default 10)")
+    args = parser.parse_args()
+
+    url = "http://%s%s" % (args.host, args.path)
+    deadline = time.time() + args.duration
+
+    print("Loading %s with %d workers for %ds..."
+          % (url, args.workers, args.duration))
+
+    workers = [Worker(url, deadline, args.timeout) for _ in range(args.workers)]
+    start = time.time()
+    for w in workers:
+        w.start()
+    for w in workers:
+        w.join()
+    elapsed = time.time() - start
+
+    latencies = sorted(l for w in workers for l in w.latencies)
+    errors = sum(w.errors for w in workers)
+    total_bytes = sum(w.bytes_received for w in workers)
+    count = len(latencies)
+
+    if count == 0:
+        print("No successful requests (%d errors)" % errors)
+        sys.exit(1)
+
+    print()
+    print("Requests:   %d ok, %d errors (%.1f req/s)"
+          % (count, errors, count / elapsed))
+    print("Throughput: %.1f KB/s" % (total_bytes / elapsed / 1024.0))
+    print("Latency ms: p50=%.0f  p90=%.0f  p99=%.0f  min=%.0f  max=%.0f"
+          % (percentile(latencies, 50), percentile(latencies, 90),
+             percentile(latencies, 99), latencies[0], latencies[-1]))
+
+
+if __name__ == "__main__":
+    main()
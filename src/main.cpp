@@ -21,6 +21,9 @@
 #include "modules/camera.h"
 #include "modules/config.h"
 #include "modules/flash.h"
+#include "modules/logger.h"
+#include "modules/motion.h"
+#include "modules/recorder.h"
 #include "modules/webserver.h"
 #include <WiFi.h>
 
@@ -39,6 +42,24 @@ const unsigned long WATCHDOG_RESET_INTERVAL = 10000; // 10 seconds
 // WiFi reconnect request from web UI
 volatile bool wifi_reconnect_requested = false;
 
+// Non-blocking WiFi reconnect state machine: evaluated once per loop pass
+// so the server keeps answering requests while the AP is down, instead of
+// freezing everything in delay(500) retry spins
+enum WiFiReconnectState {
+  WIFI_RECONNECT_IDLE = 0, // Connected or not yet due for a check
+  WIFI_RECONNECT_DISCONNECT, // disconnect() issued, waiting for it to settle
+  WIFI_RECONNECT_BEGIN,      // Ready to call WiFi.begin()
+  WIFI_RECONNECT_WAITING,    // Association in progress
+  WIFI_RECONNECT_BACKOFF     // Attempt failed, cooling down
+};
+
+WiFiReconnectState wifi_reconnect_state = WIFI_RECONNECT_IDLE;
+unsigned long wifi_state_since = 0;
+uint32_t wifi_reconnect_attempts = 0;
+const unsigned long WIFI_DISCONNECT_SETTLE_MS = 500;
+const unsigned long WIFI_CONNECT_TIMEOUT_MS = 10000;
+const unsigned long WIFI_RECONNECT_BACKOFF_MS = 15000;
+
 /**
  * Helper to convert IPAddress to char array safely
  */
@@ -94,17 +115,17 @@ void checkMemoryUsage() {
     size_t min_free_heap = esp_get_minimum_free_heap_size();
     size_t total_heap = heap_caps_get_total_size(MALLOC_CAP_8BIT);
 
-    Serial.printf(
+    logManager.printf(
         "Memory Status: Free=%u bytes, Min Free=%u bytes, Total=%u bytes\n",
         free_heap, min_free_heap, total_heap);
 
     // Warning thresholds
     if (free_heap < 50000) { // Less than 50KB free
-      Serial.println("WARNING: Low memory detected!");
+      logManager.println("WARNING: Low memory detected!");
     }
 
     if (min_free_heap < 30000) { // Less than 30KB minimum
-      Serial.println("CRITICAL: Very low memory detected!");
+      logManager.println("CRITICAL: Very low memory detected!");
     }
 
     last_memory_check = now;
@@ -135,40 +156,72 @@ void applyWiFiBandwidthMode() {
 }
 
 /**
- * Check WiFi connection and attempt reconnection if needed
+ * Kick the reconnect state machine into a fresh attempt (from the periodic
+ * health check, the /wifi endpoint, or emergency recovery)
+ */
+void startWiFiReconnect() {
+  WiFi.disconnect();
+  wifi_state_since = millis();
+  wifi_reconnect_state = WIFI_RECONNECT_DISCONNECT;
+  webServerManager.invalidateStatusCache(); // WiFi fields just changed
+}
+
+/**
+ * Check WiFi connection and drive the non-blocking reconnect state machine.
+ * Each call does at most one cheap step - no delay() spins - so HTTP
+ * handling and flash PWM keep running during an outage.
  */
 void checkWiFiConnection() {
   unsigned long now = millis();
-  if (now - last_wifi_check >= WIFI_CHECK_INTERVAL) {
-    if (WiFi.status() != WL_CONNECTED) {
-      Serial.println("WiFi disconnected, attempting reconnection...");
 
-      // Attempt reconnection
-      WiFi.disconnect();
-      delay(1000);
-      WiFi.begin(configManager.getWiFiSSID(), configManager.getWiFiPassword());
-      applyWiFiBandwidthMode();
+  switch (wifi_reconnect_state) {
+    case WIFI_RECONNECT_IDLE:
+      if (now - last_wifi_check >= WIFI_CHECK_INTERVAL) {
+        last_wifi_check = now;
+        if (WiFi.status() != WL_CONNECTED) {
+          Serial.println("WiFi disconnected, attempting reconnection...");
+          startWiFiReconnect();
+        }
+      }
+      break;
 
-      // Wait for connection with timeout
-      int attempts = 0;
-      while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-        delay(500);
-        attempts++;
-        Serial.print(".");
+    case WIFI_RECONNECT_DISCONNECT:
+      if (now - wifi_state_since >= WIFI_DISCONNECT_SETTLE_MS) {
+        wifi_reconnect_state = WIFI_RECONNECT_BEGIN;
       }
+      break;
+
+    case WIFI_RECONNECT_BEGIN:
+      WiFi.begin(configManager.getWiFiSSID(), configManager.getWiFiPassword());
+      applyWiFiBandwidthMode();
+      wifi_state_since = now;
+      wifi_reconnect_state = WIFI_RECONNECT_WAITING;
+      break;
 
+    case WIFI_RECONNECT_WAITING:
       if (WiFi.status() == WL_CONNECTED) {
-        Serial.println();
+        wifi_reconnect_attempts = 0;
+        wifi_reconnect_state = WIFI_RECONNECT_IDLE;
+        last_wifi_check = now;
+        webServerManager.invalidateStatusCache();
         Serial.println("WiFi reconnected successfully");
         char ip_str[16];
         WiFi.localIP().toString().toCharArray(ip_str, sizeof(ip_str));
         Serial.printf("IP Address: %s\n", ip_str);
-      } else {
-        Serial.println();
-        Serial.println("WiFi reconnection failed");
+      } else if (now - wifi_state_since >= WIFI_CONNECT_TIMEOUT_MS) {
+        wifi_reconnect_attempts++;
+        Serial.printf("WiFi reconnection attempt %u failed, backing off\n",
+                      wifi_reconnect_attempts);
+        wifi_state_since = now;
+        wifi_reconnect_state = WIFI_RECONNECT_BACKOFF;
       }
-    }
-    last_wifi_check = now;
+      break;
+
+    case WIFI_RECONNECT_BACKOFF:
+      if (now - wifi_state_since >= WIFI_RECONNECT_BACKOFF_MS) {
+        startWiFiReconnect();
+      }
+      break;
   }
 }
 
@@ -181,23 +234,9 @@ void emergencyRecovery() {
   // Reset watchdog to prevent immediate restart
   esp_task_wdt_reset();
 
-  // Attempt to restart WiFi
-  WiFi.disconnect();
-  delay(2000);
-  WiFi.begin(configManager.getWiFiSSID(), configManager.getWiFiPassword());
-
-  // Wait briefly for WiFi
-  delay(5000);
-
-  // Restart web server if WiFi is connected
-  if (WiFi.status() == WL_CONNECTED) {
-    webServerManager.stop();
-    delay(1000);
-    webServerManager.begin();
-    Serial.println("Emergency recovery completed");
-  } else {
-    Serial.println("Emergency recovery failed - manual intervention required");
-  }
+  // Force a fresh WiFi association through the non-blocking state machine;
+  // the loop keeps serving whatever still works while it runs
+  startWiFiReconnect();
 }
 
 // ===================
@@ -205,9 +244,11 @@ void emergencyRecovery() {
 // ===================
 
 /**
- * Initialize WiFi connection using configuration
+ * Start the WiFi association (non-blocking part). Called before camera
+ * init so association proceeds concurrently with the sensor bring-up;
+ * initWiFiWaitForConnection() collects the result afterwards.
  */
-void initWiFi() {
+void initWiFiBegin() {
   Serial.println("========== WiFi Configuration ==========");
   Serial.printf("SSID: %s\n", configManager.getWiFiSSID());
 
@@ -258,7 +299,12 @@ void initWiFi() {
   applyWiFiBandwidthMode();
 
   Serial.println("WiFi bandwidth mode applied from configuration");
+}
 
+/**
+ * Wait for the association started by initWiFiBegin() to complete
+ */
+void initWiFiWaitForConnection() {
   // Non-blocking connection with watchdog resets
   int attempts = 0;
   const int maxAttempts = 30; // 15 seconds timeout
@@ -348,17 +394,34 @@ void setup() {
     return;
   }
 
+  // Start WiFi association first so it proceeds concurrently with the
+  // camera bring-up below instead of serializing after it
+  initWiFiBegin();
+
   if (!cameraManager.begin(configManager.getJPEGQuality(),
-                           configManager.getDefaultResolution())) {
+                           configManager.getDefaultResolution(),
+                           configManager.getCameraInitOK())) {
     Serial.println(
         "WARNING: Camera initialization failed - continuing without camera");
     Serial.println("System will run in limited mode (no photo capture)");
+    configManager.setCameraInitOK(false);
     // Continue without camera - system can still provide status and other
     // services
+  } else {
+    configManager.setCameraInitOK(true);
   }
 
-  // Initialize WiFi connection
-  initWiFi();
+  // Keep the latest frame ready for the fast /snap endpoint, and watch the
+  // ring for motion events. The capture task's first grab doubles as the
+  // sensor pre-capture, so a frame is already waiting when WiFi comes up.
+  if (cameraManager.isReady()) {
+    cameraManager.startContinuousCapture();
+    motionManager.begin();
+    recorderManager.begin(); // No-op without an SD card
+  }
+
+  // Collect the WiFi association result
+  initWiFiWaitForConnection();
 
   // Start web server
   if (!webServerManager.begin()) {
@@ -409,26 +472,40 @@ void loop() {
   checkMemoryUsage();
   checkWiFiConnection();
 
-  // Check for critical memory conditions
+  // Check for critical memory conditions. Recovery is non-blocking now, so
+  // rate-limit it instead of relying on its old delay() spins
+  static unsigned long last_emergency_recovery = 0;
   size_t free_heap = esp_get_free_heap_size();
-  if (free_heap < 20000) { // Less than 20KB free
+  if (free_heap < 20000 &&
+      (last_emergency_recovery == 0 ||
+       millis() - last_emergency_recovery > 30000)) { // Less than 20KB free
     Serial.println("CRITICAL: Very low memory, triggering emergency recovery");
+    last_emergency_recovery = millis();
     emergencyRecovery();
   }
 
+  // Drain a deferred config commit once no capture is in flight - flash
+  // writes disable interrupts and would glitch an active frame DMA
+  if (configManager.hasPendingSave() && !cameraManager.isCaptureInFlight()) {
+    configManager.commitPendingSave();
+  }
+
   // Handle deferred WiFi reconnect from /wifi endpoint
   if (wifi_reconnect_requested) {
     wifi_reconnect_requested = false;
     Serial.println("WiFi reconnect requested by web UI...");
     Serial.printf("Using saved credentials - SSID: %s\n", configManager.getWiFiSSID());
-    WiFi.disconnect();
-    delay(500);
-    WiFi.begin(configManager.getWiFiSSID(), configManager.getWiFiPassword());
-    applyWiFiBandwidthMode();
+    startWiFiReconnect();
+  }
+
+  // Handle incoming HTTP requests from loop() only when the server is not
+  // running in its own task (see WEBSERVER_USE_DEDICATED_TASK)
+  if (!webServerManager.hasDedicatedTask()) {
+    webServerManager.handleClients();
   }
 
-  // Handle incoming HTTP requests using the web server manager
-  webServerManager.handleClients();
+  // Push deferred log bytes to the UART from idle time
+  logManager.drain();
 
   // Small delay to prevent watchdog issues
   delay(1);
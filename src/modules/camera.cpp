@@ -1,4 +1,10 @@
 #include "camera.h"
+#include "flash.h"
+#include "logger.h"
+#include "metrics.h"
+#include "esp_task_wdt.h"
+#include "esp_heap_caps.h"
+#include "img_converters.h"
 
 // Global instance
 CameraManager cameraManager;
@@ -11,8 +17,20 @@ CameraManager::CameraManager() :
   failed_capture_count(0),
   last_capture_time(0),
   last_frame_size(0),
-  frame_buffer_active(false) {
-  
+  first_capture_time(0),
+  settings_cache_valid(false),
+  quality_before_override(10),
+  quality_override_active(false),
+  ae_converged(false),
+  frame_buffer_active(false),
+  capture_task_handle(nullptr),
+  continuous_capture_running(false),
+  newest_ring_index(-1) {
+
+  memset(frame_ring, 0, sizeof(frame_ring));
+  ring_mutex = xSemaphoreCreateMutex();
+  capture_lock = xSemaphoreCreateMutex();
+
   // Initialize default settings
   default_settings.resolution = FRAMESIZE_UXGA;
   default_settings.jpeg_quality = 10;
@@ -27,18 +45,24 @@ CameraManager::CameraManager() :
   default_settings.vflip = false;
 }
 
-bool CameraManager::begin(uint8_t jpeg_quality, framesize_t default_resolution) {
-  Serial.println("Initializing camera...");
+bool CameraManager::begin(uint8_t jpeg_quality, framesize_t default_resolution,
+                          bool fast_boot) {
+  Serial.println(fast_boot ? "Initializing camera (fast boot)..."
+                           : "Initializing camera...");
   framesize_t safe_resolution = getSafeFrameSize(default_resolution);
   default_settings.resolution = safe_resolution;
   default_settings.jpeg_quality = constrain(jpeg_quality, 0, 63);
-  
-  // Retry camera initialization up to 3 times
+
+  // Retry camera initialization up to 3 times. Known-good hardware
+  // (fast_boot) retries without the 1 s settle delays - failures there are
+  // transient glitches, not a sensor that needs time to appear.
   const int max_retries = 3;
   for (int retry = 0; retry < max_retries; retry++) {
     if (retry > 0) {
       Serial.printf("Camera initialization retry %d/%d...\n", retry + 1, max_retries);
-      delay(1000); // Wait before retry
+      if (!fast_boot) {
+        delay(1000); // Wait before retry
+      }
     }
     
     if (configureCamera(jpeg_quality, safe_resolution)) {
@@ -129,10 +153,56 @@ framesize_t CameraManager::getSafeFrameSize(framesize_t resolution) {
     getResolutionString(resolution, requested, sizeof(requested));
     Serial.printf("Requested resolution %s requires PSRAM; using VGA instead\n",
                   requested);
-    return FRAMESIZE_VGA;
+    resolution = FRAMESIZE_VGA;
+  }
+
+  return budgetFrameSize(resolution);
+}
+
+/**
+ * Conservative worst-case encoded size for a framesize (quality 10 JPEG
+ * plus headroom for the driver's metadata)
+ */
+static size_t estimateJpegBytes(framesize_t fs) {
+  return ((size_t)resolution[fs].width * resolution[fs].height) / 4 + 8192;
+}
+
+/**
+ * Check actual memory state before committing to a framesize instead of
+ * discovering OOM after esp_camera_fb_get() fails: step down the ladder to
+ * the largest resolution whose estimated frame currently fits. A slightly
+ * smaller frame beats a 500 and a retry loop every time.
+ */
+framesize_t CameraManager::budgetFrameSize(framesize_t requested) {
+  // The init-time buffer already accommodates anything at or below the
+  // active resolution - only raising it (or initializing) needs a budget
+  if (camera_ready && requested <= current_resolution) {
+    return requested;
+  }
+
+  static const framesize_t LADDER[] = {FRAMESIZE_UXGA, FRAMESIZE_SVGA,
+                                       FRAMESIZE_VGA, FRAMESIZE_QVGA};
+
+  size_t budget = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+  if (estimateJpegBytes(requested) <= budget) {
+    return requested;
   }
 
-  return resolution;
+  for (size_t i = 0; i < sizeof(LADDER) / sizeof(LADDER[0]); i++) {
+    if (LADDER[i] >= requested) {
+      continue; // Only step downwards
+    }
+    if (estimateJpegBytes(LADDER[i]) <= budget) {
+      char from_str[32], to_str[32];
+      getResolutionString(requested, from_str, sizeof(from_str));
+      getResolutionString(LADDER[i], to_str, sizeof(to_str));
+      Serial.printf("Frame budget: %s doesn't fit (%u bytes free), using %s\n",
+                    from_str, budget, to_str);
+      return LADDER[i];
+    }
+  }
+
+  return FRAMESIZE_QVGA; // Smallest rung - always worth attempting
 }
 
 bool CameraManager::initializeCameraSensor() {
@@ -224,6 +294,7 @@ bool CameraManager::setResolution(framesize_t resolution) {
   }
   
   current_resolution = safe_resolution;
+  ae_converged = false; // Sensor re-locks and AE restarts on a size change
   char resolution_str[32];
   getResolutionString(safe_resolution, resolution_str, sizeof(resolution_str));
   Serial.printf("Resolution changed to: %s\n", resolution_str);
@@ -240,62 +311,60 @@ camera_fb_t* CameraManager::captureFrame() {
     logCaptureResult(CAPTURE_CAMERA_NOT_READY);
     return nullptr;
   }
-  
+
+  // Serialize sensor access across the capture task and request handlers.
+  // The lock is held until releaseFrameBuffer() returns the frame.
+  if (xSemaphoreTake(capture_lock, pdMS_TO_TICKS(CAPTURE_LOCK_TIMEOUT_MS)) != pdTRUE) {
+    logCaptureResult(CAPTURE_FAILED);
+    return nullptr;
+  }
+
   if (frame_buffer_active) {
-    Serial.println("WARNING: Previous frame buffer not released");
+    logManager.println("WARNING: Previous frame buffer not released");
+    xSemaphoreGive(capture_lock);
     logCaptureResult(CAPTURE_FAILED);
     return nullptr;
   }
-  
+
+  unsigned long capture_start = millis();
   camera_fb_t* fb = esp_camera_fb_get();
-  
+  metricsManager.recordLatency(METRIC_CAPTURE, millis() - capture_start);
+
   if (fb) {
     frame_buffer_active = true;
     capture_count++;
     last_capture_time = millis();
     last_frame_size = fb->len;
+    if (first_capture_time == 0) {
+      first_capture_time = last_capture_time;
+      logManager.printf("First frame ready %lu ms after boot\n",
+                        first_capture_time);
+    }
     logCaptureResult(CAPTURE_SUCCESS);
   } else {
     failed_capture_count++;
+    xSemaphoreGive(capture_lock);
     logCaptureResult(CAPTURE_FAILED);
   }
-  
+
   return fb;
 }
 
 camera_fb_t* CameraManager::captureWithFlash(bool use_flash) {
-  if (!camera_ready) {
-    logCaptureResult(CAPTURE_CAMERA_NOT_READY);
-    return nullptr;
-  }
-  
-  if (frame_buffer_active) {
-    Serial.println("WARNING: Previous frame buffer not released");
-    logCaptureResult(CAPTURE_FAILED);
-    return nullptr;
-  }
-  
   if (use_flash) {
     Serial.println("FLASH CAPTURE: Starting synchronized flash capture");
     delay(200);
   }
-  
-  // Capture the final frame immediately
-  camera_fb_t* fb = esp_camera_fb_get();
-  
+
+  // captureFrame() takes the capture lock and tracks buffer state
+  camera_fb_t* fb = captureFrame();
+
   if (fb) {
-    frame_buffer_active = true;
-    capture_count++;
-    last_capture_time = millis();
-    last_frame_size = fb->len;
-    logCaptureResult(CAPTURE_SUCCESS);
     Serial.println("Capture complete");
   } else {
-    failed_capture_count++;
-    logCaptureResult(CAPTURE_FAILED);
     Serial.println("Capture failed");
   }
-  
+
   return fb;
 }
 
@@ -319,18 +388,241 @@ CaptureResult CameraManager::captureToBuffer(uint8_t** buffer, size_t* buffer_si
   return CAPTURE_SUCCESS;
 }
 
+/**
+ * Read frame dimensions from a JPEG's SOF marker. Returns false when no
+ * baseline/progressive SOF is found in the header area.
+ */
+static bool jpegDimensions(const uint8_t* jpeg, size_t len,
+                           uint16_t* width, uint16_t* height) {
+  size_t i = 2; // Skip SOI
+  while (i + 9 < len && jpeg[i] == 0xFF) {
+    uint8_t marker = jpeg[i + 1];
+    uint16_t seg_len = ((uint16_t)jpeg[i + 2] << 8) | jpeg[i + 3];
+
+    // SOF0..SOF3, SOF5..SOF7, SOF9..SOF11, SOF13..SOF15 all carry dims
+    if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 &&
+        marker != 0xC8 && marker != 0xCC) {
+      *height = ((uint16_t)jpeg[i + 5] << 8) | jpeg[i + 6];
+      *width = ((uint16_t)jpeg[i + 7] << 8) | jpeg[i + 8];
+      return *width > 0 && *height > 0;
+    }
+
+    if (marker == 0xDA) {
+      break; // Start of scan - no SOF seen
+    }
+    i += 2 + seg_len;
+  }
+  return false;
+}
+
+/**
+ * Produce a small preview JPEG from a full-res capture by decoding at 1/4
+ * scale into RGB565 and re-encoding. Costs one transient RGB buffer
+ * (~38 KB for VGA) but never reconfigures the sensor, so it cannot corrupt
+ * the next full-res capture the way a per-request set_framesize would.
+ */
+bool CameraManager::makeThumbnail(const uint8_t* jpeg, size_t jpeg_len,
+                                  uint8_t** out, size_t* out_len) {
+  if (!jpeg || jpeg_len == 0 || !out || !out_len) {
+    return false;
+  }
+
+  // Size the decode buffer from the JPEG itself - a ring frame may predate
+  // a sensor resolution change
+  uint16_t src_w = 0;
+  uint16_t src_h = 0;
+  if (!jpegDimensions(jpeg, jpeg_len, &src_w, &src_h)) {
+    Serial.println("Thumbnail skipped: could not read JPEG dimensions");
+    return false;
+  }
+  uint16_t thumb_w = src_w / THUMBNAIL_SCALE_DIV;
+  uint16_t thumb_h = src_h / THUMBNAIL_SCALE_DIV;
+  if (thumb_w == 0 || thumb_h == 0) {
+    return false;
+  }
+  size_t rgb_size = (size_t)thumb_w * thumb_h * 2; // RGB565
+
+  // Pre-flight: don't even try when the decode buffer wouldn't fit
+  if (heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) < rgb_size + 8192) {
+    Serial.println("Thumbnail skipped: insufficient free heap");
+    return false;
+  }
+
+  uint8_t *rgb = (uint8_t *)malloc(rgb_size);
+  if (!rgb) {
+    return false;
+  }
+
+  bool ok = jpg2rgb565(jpeg, jpeg_len, rgb, JPG_SCALE_4X);
+  if (ok) {
+    ok = fmt2jpg(rgb, rgb_size, thumb_w, thumb_h, PIXFORMAT_RGB565,
+                 THUMBNAIL_JPEG_QUALITY, out, out_len);
+  }
+
+  free(rgb);
+
+  if (!ok) {
+    Serial.println("Thumbnail generation failed");
+  }
+  return ok;
+}
+
 void CameraManager::releaseFrameBuffer(camera_fb_t* fb) {
   if (fb && frame_buffer_active) {
     esp_camera_fb_return(fb);
     frame_buffer_active = false;
+    xSemaphoreGive(capture_lock);
   } else if (fb && !frame_buffer_active) {
     Serial.println("WARNING: Attempted to release frame buffer that wasn't active");
     esp_camera_fb_return(fb); // Still release it to prevent leaks
   }
 }
 
+// Continuous capture (latest-frame ring)
+
+/**
+ * Entry point for the background capture task
+ */
+static void captureTask(void *param) {
+  CameraManager *manager = (CameraManager *)param;
+
+  esp_task_wdt_add(NULL);
+  manager->continuousCaptureLoop();
+  esp_task_wdt_delete(NULL);
+
+  manager->notifyCaptureTaskExit();
+  vTaskDelete(NULL);
+}
+
+bool CameraManager::startContinuousCapture() {
+  if (!camera_ready) {
+    Serial.println("Cannot start continuous capture: camera not ready");
+    return false;
+  }
+  if (capture_task_handle) {
+    return true; // Already running
+  }
+
+  continuous_capture_running = true;
+  BaseType_t created = xTaskCreatePinnedToCore(
+      captureTask, "capture", CAPTURE_TASK_STACK_SIZE, this,
+      CAPTURE_TASK_PRIORITY, &capture_task_handle, CAPTURE_TASK_CORE);
+
+  if (created != pdPASS) {
+    capture_task_handle = nullptr;
+    continuous_capture_running = false;
+    Serial.println("Failed to create capture task");
+    return false;
+  }
+
+  Serial.printf("Continuous capture task running on core %d\n",
+                CAPTURE_TASK_CORE);
+  return true;
+}
+
+void CameraManager::stopContinuousCapture() {
+  continuous_capture_running = false;
+  unsigned long stop_start = millis();
+  while (capture_task_handle && (millis() - stop_start) < 2000) {
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+}
+
+/**
+ * Background task body: keep grabbing frames and copying the newest JPEG
+ * into a ring entry that is not checked out by a request handler
+ */
+void CameraManager::continuousCaptureLoop() {
+  while (continuous_capture_running) {
+    esp_task_wdt_reset();
+
+    camera_fb_t* fb = captureFrame();
+    if (!fb) {
+      // Sensor busy (a request handler holds the capture lock) or failed;
+      // back off briefly and retry
+      vTaskDelay(pdMS_TO_TICKS(CONTINUOUS_CAPTURE_INTERVAL_MS));
+      continue;
+    }
+
+    // Pick a ring slot that is not the newest and has no holders left
+    xSemaphoreTake(ring_mutex, portMAX_DELAY);
+    int slot = -1;
+    for (int i = 0; i < CAPTURE_RING_SIZE; i++) {
+      if (i != newest_ring_index && frame_ring[i].ref_count == 0) {
+        slot = i;
+        break;
+      }
+    }
+    xSemaphoreGive(ring_mutex);
+
+    if (slot >= 0) {
+      RingFrame &entry = frame_ring[slot];
+
+      // Grow the copy buffer only when the frame doesn't fit
+      if (entry.capacity < fb->len) {
+        uint8_t *grown = (uint8_t *)realloc(entry.buf, fb->len);
+        if (grown) {
+          entry.buf = grown;
+          entry.capacity = fb->len;
+        }
+      }
+
+      if (entry.capacity >= fb->len) {
+        memcpy(entry.buf, fb->buf, fb->len);
+        entry.len = fb->len;
+        entry.timestamp = millis();
+
+        xSemaphoreTake(ring_mutex, portMAX_DELAY);
+        newest_ring_index = slot;
+        xSemaphoreGive(ring_mutex);
+      }
+      // On allocation failure the stale entry is kept; /snap serves the
+      // previous frame rather than nothing
+    }
+
+    releaseFrameBuffer(fb);
+    vTaskDelay(pdMS_TO_TICKS(CONTINUOUS_CAPTURE_INTERVAL_MS));
+  }
+}
+
+/**
+ * Check out the newest ring frame for sending. Returns the ring index
+ * (pass it to releaseRingFrame when done) or -1 when no frame is ready.
+ */
+int CameraManager::acquireLatestFrame(uint8_t** buf, size_t* len,
+                                      unsigned long* timestamp) {
+  xSemaphoreTake(ring_mutex, portMAX_DELAY);
+
+  int index = newest_ring_index;
+  if (index < 0 || frame_ring[index].len == 0) {
+    xSemaphoreGive(ring_mutex);
+    return -1;
+  }
+
+  frame_ring[index].ref_count++;
+  *buf = frame_ring[index].buf;
+  *len = frame_ring[index].len;
+  if (timestamp) {
+    *timestamp = frame_ring[index].timestamp;
+  }
+
+  xSemaphoreGive(ring_mutex);
+  return index;
+}
+
+void CameraManager::releaseRingFrame(int index) {
+  if (index < 0 || index >= CAPTURE_RING_SIZE) {
+    return;
+  }
+  xSemaphoreTake(ring_mutex, portMAX_DELAY);
+  if (frame_ring[index].ref_count > 0) {
+    frame_ring[index].ref_count--;
+  }
+  xSemaphoreGive(ring_mutex);
+}
+
 // Camera settings
-bool CameraManager::applySettings(const CameraSettings& settings) {
+bool CameraManager::applySettings(const CameraSettings& settings, bool force) {
   if (!camera_ready) {
     return false;
   }
@@ -342,75 +634,182 @@ bool CameraManager::applySettings(const CameraSettings& settings) {
   if (!validateSettings(safe_settings)) {
     return false;
   }
-  
+
+  // Diff against the last settings written to the sensor so steady-state
+  // requests (pollers resending identical values) skip every SCCB write
+  bool diff = !settings_cache_valid || force;
+  const CameraSettings &prev = last_applied_settings;
+
+  if (!diff && safe_settings.resolution == prev.resolution &&
+      safe_settings.jpeg_quality == prev.jpeg_quality &&
+      safe_settings.brightness == prev.brightness &&
+      safe_settings.contrast == prev.contrast &&
+      safe_settings.saturation == prev.saturation &&
+      safe_settings.exposure == prev.exposure &&
+      safe_settings.gain == prev.gain &&
+      safe_settings.special_effect == prev.special_effect &&
+      safe_settings.wb_mode == prev.wb_mode &&
+      safe_settings.hmirror == prev.hmirror &&
+      safe_settings.vflip == prev.vflip) {
+    return true; // Nothing changed - no I2C traffic at all
+  }
+
   sensor_t* s = getSensor();
   if (!s) return false;
-  
+
+  unsigned long apply_start = millis();
+
   char resolution_str[32];
   getResolutionString(safe_settings.resolution, resolution_str, sizeof(resolution_str));
-  
-  // Apply resolution first
+
+  // Apply resolution first - skipped entirely when unchanged so the sensor
+  // never re-locks
   if (safe_settings.resolution != current_resolution) {
     if (!setResolution(safe_settings.resolution)) {
       return false;
     }
   }
-  
-  if (s->set_quality(s, safe_settings.jpeg_quality) != 0) {
-    Serial.printf("Failed to set JPEG quality to %d\n", safe_settings.jpeg_quality);
-    return false;
+
+  if (diff || safe_settings.jpeg_quality != prev.jpeg_quality) {
+    if (s->set_quality(s, safe_settings.jpeg_quality) != 0) {
+      Serial.printf("Failed to set JPEG quality to %d\n", safe_settings.jpeg_quality);
+      return false;
+    }
   }
 
   // Apply basic image settings
-  s->set_brightness(s, constrain(safe_settings.brightness, -2, 2));
-  s->set_contrast(s, constrain(safe_settings.contrast, -2, 2));
-  s->set_saturation(s, constrain(safe_settings.saturation, -2, 2));
-  s->set_special_effect(s, constrain(safe_settings.special_effect, 0, 6));
-  
+  if (diff || safe_settings.brightness != prev.brightness) {
+    s->set_brightness(s, constrain(safe_settings.brightness, -2, 2));
+    ae_converged = false;
+  }
+  if (diff || safe_settings.contrast != prev.contrast)
+    s->set_contrast(s, constrain(safe_settings.contrast, -2, 2));
+  if (diff || safe_settings.saturation != prev.saturation)
+    s->set_saturation(s, constrain(safe_settings.saturation, -2, 2));
+  if (diff || safe_settings.special_effect != prev.special_effect)
+    s->set_special_effect(s, constrain(safe_settings.special_effect, 0, 6));
+
   // Apply white balance settings
-  if (safe_settings.wb_mode == 0) {
-    s->set_whitebal(s, 1); // Enable auto white balance
-    s->set_awb_gain(s, 1);
-    s->set_wb_mode(s, 0);
-  } else {
-    s->set_whitebal(s, 0); // Disable auto white balance
-    s->set_wb_mode(s, constrain(safe_settings.wb_mode, 0, 4));
+  if (diff || safe_settings.wb_mode != prev.wb_mode) {
+    ae_converged = false;
+    if (safe_settings.wb_mode == 0) {
+      s->set_whitebal(s, 1); // Enable auto white balance
+      s->set_awb_gain(s, 1);
+      s->set_wb_mode(s, 0);
+    } else {
+      s->set_whitebal(s, 0); // Disable auto white balance
+      s->set_wb_mode(s, constrain(safe_settings.wb_mode, 0, 4));
+    }
   }
-  
+
   // Apply gain control
-  if (safe_settings.gain > 0) {
-    s->set_gain_ctrl(s, 0); // Disable auto gain
-    s->set_agc_gain(s, constrain(safe_settings.gain, 0, 30)); // Set manual gain
-  } else {
-    s->set_gain_ctrl(s, 1); // Enable auto gain
+  if (diff || safe_settings.gain != prev.gain) {
+    ae_converged = false;
+    if (safe_settings.gain > 0) {
+      s->set_gain_ctrl(s, 0); // Disable auto gain
+      s->set_agc_gain(s, constrain(safe_settings.gain, 0, 30)); // Set manual gain
+    } else {
+      s->set_gain_ctrl(s, 1); // Enable auto gain
+    }
   }
-  
+
   // Apply orientation settings
-  s->set_hmirror(s, safe_settings.hmirror ? 1 : 0);
-  s->set_vflip(s, safe_settings.vflip ? 1 : 0);
-  
-  // Use auto exposure for high resolutions to prevent corruption
-  if (safe_settings.resolution <= FRAMESIZE_VGA && safe_settings.exposure > 0) {
-    // Only use manual exposure for smaller resolutions
-    s->set_exposure_ctrl(s, 0); // 0 = disable auto exposure
-    s->set_aec_value(s, constrain(safe_settings.exposure, 0, 1200)); // Set manual exposure value
-    s->set_aec2(s, 0); // Disable AEC2
-    Serial.println("Manual exposure enabled (small resolution)");
-  } else {
-    // Use auto exposure for high resolutions
-    s->set_exposure_ctrl(s, 1); // 1 = enable auto exposure
-    s->set_aec2(s, 1); // Enable AEC2
-    Serial.println("Auto exposure enabled (high resolution protection)");
+  if (diff || safe_settings.hmirror != prev.hmirror)
+    s->set_hmirror(s, safe_settings.hmirror ? 1 : 0);
+  if (diff || safe_settings.vflip != prev.vflip)
+    s->set_vflip(s, safe_settings.vflip ? 1 : 0);
+
+  // Use auto exposure for high resolutions to prevent corruption. The mode
+  // depends on both exposure and resolution, so diff on the pair.
+  if (diff || safe_settings.exposure != prev.exposure ||
+      safe_settings.resolution != prev.resolution) {
+    ae_converged = false;
+    if (safe_settings.resolution <= FRAMESIZE_VGA && safe_settings.exposure > 0) {
+      // Only use manual exposure for smaller resolutions
+      s->set_exposure_ctrl(s, 0); // 0 = disable auto exposure
+      s->set_aec_value(s, constrain(safe_settings.exposure, 0, 1200)); // Set manual exposure value
+      s->set_aec2(s, 0); // Disable AEC2
+      Serial.println("Manual exposure enabled (small resolution)");
+    } else {
+      // Use auto exposure for high resolutions
+      s->set_exposure_ctrl(s, 1); // 1 = enable auto exposure
+      s->set_aec2(s, 1); // Enable AEC2
+      Serial.println("Auto exposure enabled (high resolution protection)");
+    }
   }
-  
+
+  last_applied_settings = safe_settings;
+  settings_cache_valid = true;
+
+  metricsManager.recordLatency(METRIC_SETTINGS_APPLY, millis() - apply_start);
+
   Serial.printf("Applied camera settings - Res: %s, Quality: %d, Brightness: %d, Contrast: %d, Gain: %d\n",
-               resolution_str, 
+               resolution_str,
                safe_settings.jpeg_quality, safe_settings.brightness,
                safe_settings.contrast, safe_settings.gain);
-  
+
+  return true;
+}
+
+// Pre-validated sensor quality levels (lower = better). Arbitrary values
+// are snapped to the nearest of these so a typo'd ?quality= can't push the
+// encoder into a setting we have never exercised.
+static const uint8_t QUALITY_LEVELS[] = {10, 20, 30, 40};
+
+uint8_t CameraManager::snapToQualityLevel(uint8_t requested) {
+  uint8_t best = QUALITY_LEVELS[0];
+  int best_delta = 255;
+  for (size_t i = 0; i < sizeof(QUALITY_LEVELS); i++) {
+    int delta = (int)requested - (int)QUALITY_LEVELS[i];
+    if (delta < 0) {
+      delta = -delta;
+    }
+    if (delta < best_delta) {
+      best_delta = delta;
+      best = QUALITY_LEVELS[i];
+    }
+  }
+  return best;
+}
+
+bool CameraManager::beginQualityOverride(uint8_t requested, uint8_t* applied) {
+  if (!camera_ready || quality_override_active) {
+    return false;
+  }
+  sensor_t* s = getSensor();
+  if (!s) {
+    return false;
+  }
+
+  uint8_t level = snapToQualityLevel(requested);
+  quality_before_override = settings_cache_valid
+                                ? last_applied_settings.jpeg_quality
+                                : default_settings.jpeg_quality;
+
+  if (level != quality_before_override) {
+    if (s->set_quality(s, level) != 0) {
+      return false;
+    }
+    quality_override_active = true;
+  }
+
+  if (applied) {
+    *applied = level;
+  }
   return true;
 }
 
+void CameraManager::endQualityOverride() {
+  if (!quality_override_active) {
+    return;
+  }
+  sensor_t* s = getSensor();
+  if (s) {
+    s->set_quality(s, quality_before_override);
+  }
+  quality_override_active = false;
+}
+
 bool CameraManager::resetToDefaults() {
   return applySettings(default_settings);
 }
@@ -430,30 +829,42 @@ CameraSettings CameraManager::getCurrentSettings() {
 
 // Individual setting controls
 bool CameraManager::setBrightness(int8_t brightness) {
+  // Direct sensor write bypasses applySettings() - drop its diff cache
+  invalidateSettingsCache();
+  ae_converged = false;
   if (!camera_ready) return false;
   sensor_t* s = getSensor();
   return s && s->set_brightness(s, constrain(brightness, -2, 2)) == 0;
 }
 
 bool CameraManager::setContrast(int8_t contrast) {
+  // Direct sensor write bypasses applySettings() - drop its diff cache
+  invalidateSettingsCache();
   if (!camera_ready) return false;
   sensor_t* s = getSensor();
   return s && s->set_contrast(s, constrain(contrast, -2, 2)) == 0;
 }
 
 bool CameraManager::setSaturation(int8_t saturation) {
+  // Direct sensor write bypasses applySettings() - drop its diff cache
+  invalidateSettingsCache();
   if (!camera_ready) return false;
   sensor_t* s = getSensor();
   return s && s->set_saturation(s, constrain(saturation, -2, 2)) == 0;
 }
 
 bool CameraManager::setJPEGQuality(uint8_t quality) {
+  // Direct sensor write bypasses applySettings() - drop its diff cache
+  invalidateSettingsCache();
   if (!camera_ready || quality > 63) return false;
   sensor_t* s = getSensor();
   return s && s->set_quality(s, quality) == 0;
 }
 
 bool CameraManager::setExposure(uint16_t exposure) {
+  // Direct sensor write bypasses applySettings() - drop its diff cache
+  invalidateSettingsCache();
+  ae_converged = false;
   if (!camera_ready) return false;
   sensor_t* s = getSensor();
   if (!s) return false;
@@ -473,6 +884,9 @@ bool CameraManager::setExposure(uint16_t exposure) {
 }
 
 bool CameraManager::setGain(uint8_t gain) {
+  // Direct sensor write bypasses applySettings() - drop its diff cache
+  invalidateSettingsCache();
+  ae_converged = false;
   if (!camera_ready) return false;
   sensor_t* s = getSensor();
   if (!s) return false;
@@ -490,12 +904,17 @@ bool CameraManager::setGain(uint8_t gain) {
 }
 
 bool CameraManager::setSpecialEffect(uint8_t effect) {
+  // Direct sensor write bypasses applySettings() - drop its diff cache
+  invalidateSettingsCache();
   if (!camera_ready) return false;
   sensor_t* s = getSensor();
   return s && s->set_special_effect(s, constrain(effect, 0, 6)) == 0;
 }
 
 bool CameraManager::setWhiteBalance(uint8_t wb_mode) {
+  // Direct sensor write bypasses applySettings() - drop its diff cache
+  invalidateSettingsCache();
+  ae_converged = false;
   if (!camera_ready) return false;
   sensor_t* s = getSensor();
   if (!s) return false;
@@ -515,12 +934,16 @@ bool CameraManager::setWhiteBalance(uint8_t wb_mode) {
 }
 
 bool CameraManager::setHorizontalMirror(bool enable) {
+  // Direct sensor write bypasses applySettings() - drop its diff cache
+  invalidateSettingsCache();
   if (!camera_ready) return false;
   sensor_t* s = getSensor();
   return s && s->set_hmirror(s, enable ? 1 : 0) == 0;
 }
 
 bool CameraManager::setVerticalFlip(bool enable) {
+  // Direct sensor write bypasses applySettings() - drop its diff cache
+  invalidateSettingsCache();
   if (!camera_ready) return false;
   sensor_t* s = getSensor();
   return s && s->set_vflip(s, enable ? 1 : 0) == 0;
@@ -528,7 +951,59 @@ bool CameraManager::setVerticalFlip(bool enable) {
 
 // Utility functions
 bool CameraManager::warmupCamera(int frames) {
-  return true; // Disabled to save memory
+  // The fixed frame-discard heuristic is gone: convergence is detected by
+  // measuring successive frames instead of guessing how many to throw away
+  (void)frames;
+  return waitForConvergence();
+}
+
+/**
+ * Block until auto-exposure has settled after a settings change: sample
+ * successive frames' brightness until the inter-frame delta stabilizes or
+ * the deadline hits. Returns immediately (no capture at all) when nothing
+ * exposure-relevant changed since the last convergence.
+ */
+bool CameraManager::waitForConvergence() {
+  if (ae_converged || !camera_ready) {
+    return true;
+  }
+
+  unsigned long deadline = millis() + AE_CONVERGENCE_DEADLINE_MS;
+  int stable_samples = 0;
+  int last_brightness = -1;
+
+  while (millis() < deadline) {
+    camera_fb_t* fb = captureFrame();
+    if (!fb) {
+      delay(20);
+      continue;
+    }
+
+    int brightness = flashManager.measureBrightness(fb);
+    releaseFrameBuffer(fb);
+
+    if (last_brightness >= 0) {
+      int delta = brightness - last_brightness;
+      if (delta < 0) {
+        delta = -delta;
+      }
+      if (delta <= AE_CONVERGENCE_DELTA) {
+        if (++stable_samples >= AE_CONVERGENCE_STABLE_SAMPLES) {
+          ae_converged = true;
+          return true;
+        }
+      } else {
+        stable_samples = 0;
+      }
+    }
+    last_brightness = brightness;
+  }
+
+  // Deadline hit: mark converged anyway so captures proceed rather than
+  // re-paying the wait on every request
+  logManager.println("AE convergence deadline hit, proceeding");
+  ae_converged = true;
+  return false;
 }
 
 void CameraManager::printCameraInfo() {
@@ -575,21 +1050,22 @@ bool CameraManager::validateSettings(const CameraSettings& settings) {
 }
 
 void CameraManager::logCaptureResult(CaptureResult result) {
+  // Deferred: this runs inside the capture hot path
   switch (result) {
     case CAPTURE_SUCCESS:
       // Success logged elsewhere to avoid spam
       break;
     case CAPTURE_FAILED:
-      Serial.println("Capture failed");
+      logManager.println("Capture failed");
       break;
     case CAPTURE_OUT_OF_MEMORY:
-      Serial.println("Capture failed: Out of memory");
+      logManager.println("Capture failed: Out of memory");
       break;
     case CAPTURE_INVALID_RESOLUTION:
-      Serial.println("Capture failed: Invalid resolution");
+      logManager.println("Capture failed: Invalid resolution");
       break;
     case CAPTURE_CAMERA_NOT_READY:
-      Serial.println("Capture failed: Camera not ready");
+      logManager.println("Capture failed: Camera not ready");
       break;
   }
 }
@@ -22,6 +22,41 @@
 #define HREF_GPIO_NUM     23
 #define PCLK_GPIO_NUM     22
 
+// Continuous capture configuration. A background task keeps copying the
+// newest JPEG into a small ring so /snap can serve a frame at pure
+// socket-write cost instead of paying applySettings/flash/capture inline.
+#define CAPTURE_RING_SIZE 2
+#define CAPTURE_TASK_CORE 1
+#define CAPTURE_TASK_STACK_SIZE 4096
+#define CAPTURE_TASK_PRIORITY 1
+#define CONTINUOUS_CAPTURE_INTERVAL_MS 100
+#define CAPTURE_LOCK_TIMEOUT_MS 500
+
+// Thumbnail pipeline: 1/4-scale decode (VGA -> 160x120) re-encoded at a
+// dashboard-tile quality
+#define THUMBNAIL_SCALE_DIV 4
+#define THUMBNAIL_JPEG_QUALITY 60
+
+// AE convergence detection: after an exposure-relevant settings change,
+// sample successive frames' brightness until the inter-frame delta
+// stabilizes (or the deadline hits) instead of discarding a fixed number
+// of frames
+#define AE_CONVERGENCE_DELTA 6
+#define AE_CONVERGENCE_STABLE_SAMPLES 2
+#define AE_CONVERGENCE_DEADLINE_MS 600
+
+// One entry of the latest-frame ring: a heap copy of an encoded JPEG
+struct RingFrame {
+  uint8_t *buf;
+  size_t len;
+  size_t capacity;
+  unsigned long timestamp;
+  // Concurrent checkouts: /snap, the motion task and the recorder task can
+  // all hold the newest slot at once, so this is a count, not a flag - the
+  // capture task only reuses a slot once every holder has released it
+  uint8_t ref_count;
+};
+
 enum CaptureResult {
   CAPTURE_SUCCESS = 0,
   CAPTURE_FAILED = 1,
@@ -48,27 +83,68 @@ class CameraManager {
 public:
   CameraManager();
   
-  // Initialization
-  bool begin(uint8_t jpeg_quality = 10, framesize_t default_resolution = FRAMESIZE_UXGA);
+  // Initialization. fast_boot skips the 1 s inter-retry delays on hardware
+  // that initialized cleanly last boot.
+  bool begin(uint8_t jpeg_quality = 10, framesize_t default_resolution = FRAMESIZE_UXGA,
+             bool fast_boot = false);
   bool isReady() const { return camera_ready; }
   
   // Resolution management
   framesize_t getFrameSize(const String& size_param);
   framesize_t getSafeFrameSize(framesize_t resolution);
+  // Pre-flight memory budget: step the resolution down the
+  // UXGA->SVGA->VGA->QVGA ladder to the largest size whose estimated JPEG
+  // fits the largest free DMA block right now
+  framesize_t budgetFrameSize(framesize_t requested);
   void getResolutionString(framesize_t resolution, char* output, size_t max_len);
   bool setResolution(framesize_t resolution);
   framesize_t getCurrentResolution();
   
   // Camera capture
+  bool isCaptureInFlight() const { return frame_buffer_active; }
   camera_fb_t* captureFrame();
   camera_fb_t* captureWithFlash(bool use_flash);
   CaptureResult captureToBuffer(uint8_t** buffer, size_t* buffer_size, bool use_flash = false);
   void releaseFrameBuffer(camera_fb_t* fb);
+
+  // Thumbnail generation: decode-downscale-reencode of an already-encoded
+  // JPEG (the sensor's configured framesize is never touched, so the
+  // full-res path keeps its settings and lock). Caller frees *out.
+  bool makeThumbnail(const uint8_t* jpeg, size_t jpeg_len,
+                     uint8_t** out, size_t* out_len);
   
+  // Continuous capture (latest-frame ring)
+  bool startContinuousCapture();
+  void stopContinuousCapture();
+  bool isContinuousCaptureActive() const { return capture_task_handle != nullptr; }
+  int acquireLatestFrame(uint8_t** buf, size_t* len, unsigned long* timestamp);
+  void releaseRingFrame(int index);
+  void notifyCaptureTaskExit() { capture_task_handle = nullptr; }
+  void continuousCaptureLoop(); // Task body, do not call directly
+
   // Camera settings
-  bool applySettings(const CameraSettings& settings);
+  bool applySettings(const CameraSettings& settings, bool force = false);
   bool resetToDefaults();
   CameraSettings getCurrentSettings();
+  void invalidateSettingsCache() { settings_cache_valid = false; }
+  // The last settings actually written to the sensor - unlike
+  // getCurrentSettings(), which can only guess defaults (the sensor has no
+  // getters). False when nothing has been applied yet.
+  bool getLastAppliedSettings(CameraSettings &out) const {
+    if (!settings_cache_valid) {
+      return false;
+    }
+    out = last_applied_settings;
+    return true;
+  }
+
+  // Per-request JPEG quality override: one set_quality write mapped to the
+  // nearest pre-validated level, restored by endQualityOverride() without a
+  // full reconfigure - a remote viewer can pull q=30 frames while the NVR
+  // keeps its archival level
+  uint8_t snapToQualityLevel(uint8_t requested);
+  bool beginQualityOverride(uint8_t requested, uint8_t* applied = nullptr);
+  void endQualityOverride();
   
   // Individual setting controls
   bool setBrightness(int8_t brightness);
@@ -87,9 +163,12 @@ public:
   uint32_t getFailedCaptureCount() const { return failed_capture_count; }
   unsigned long getLastCaptureTime() const { return last_capture_time; }
   size_t getLastFrameSize() const { return last_frame_size; }
+  // millis() of the first successful capture == boot-to-first-frame time
+  unsigned long getFirstCaptureTime() const { return first_capture_time; }
   
   // Utility functions
-  bool warmupCamera(int frames = 3);
+  bool warmupCamera(int frames = 3); // Convergence-aware, frames is legacy
+  bool waitForConvergence();
   void printCameraInfo();
 
 private:
@@ -100,13 +179,35 @@ private:
   uint32_t failed_capture_count;
   unsigned long last_capture_time;
   size_t last_frame_size;
+  unsigned long first_capture_time;
   
   // Default camera settings
   CameraSettings default_settings;
+
+  // Last settings written to the sensor - lets applySettings() skip
+  // redundant SCCB/I2C writes when a request repeats the active values
+  CameraSettings last_applied_settings;
+  bool settings_cache_valid;
+
+  // Quality override state
+  uint8_t quality_before_override;
+  bool quality_override_active;
+
+  // Cleared whenever an exposure-relevant setting changes; set once the
+  // inter-frame brightness delta stabilizes
+  volatile bool ae_converged;
   
   // Frame buffer state tracking
   bool frame_buffer_active;
-  
+
+  // Continuous capture state
+  TaskHandle_t capture_task_handle;
+  volatile bool continuous_capture_running;
+  RingFrame frame_ring[CAPTURE_RING_SIZE];
+  int newest_ring_index;
+  SemaphoreHandle_t ring_mutex;
+  SemaphoreHandle_t capture_lock; // Serializes esp_camera_fb_get across tasks
+
   // Internal methods
   bool initializeCameraSensor();
   bool configureCamera(uint8_t jpeg_quality, framesize_t resolution);
@@ -3,75 +3,109 @@
 // Global instance
 ConfigManager configManager;
 
-ConfigManager::ConfigManager() : config_loaded(false) {
+ConfigManager::ConfigManager() : config_loaded(false), save_pending(false) {
   memset(&config, 0, sizeof(Configuration));
+  memset(&persisted, 0, sizeof(Configuration));
+}
+
+bool ConfigManager::commitPendingSave() {
+  if (!save_pending) {
+    return true;
+  }
+  save_pending = false;
+  if (!saveConfig()) {
+    Serial.println("Deferred configuration commit failed");
+    return false;
+  }
+  return true;
 }
 
 bool ConfigManager::begin() {
-  if (!EEPROM.begin(EEPROM_SIZE)) {
-    Serial.println("Failed to initialize EEPROM");
+  if (!prefs.begin(CONFIG_NVS_NAMESPACE, false)) {
+    Serial.println("Failed to initialize NVS");
     return false;
   }
 
-  Serial.println("ConfigManager initialized");
+  Serial.println("ConfigManager initialized (NVS)");
   return loadConfig();
 }
 
 bool ConfigManager::loadConfig() {
-  // Check magic number and version
-  uint16_t magic = readUint16(OFFSET_MAGIC);
-  uint16_t version = readUint16(OFFSET_VERSION);
-
-  // Migrate any older config layout that still shares the same core fields.
-  if (magic == CONFIG_MAGIC && version > 0 && version < CONFIG_VERSION) {
-    Serial.printf("Migrating config from v%d to v%d...\n", version,
-                  CONFIG_VERSION);
-    readString(OFFSET_WIFI_SSID, config.wifi_ssid, SSID_MAX_LEN);
-    readString(OFFSET_WIFI_PASSWORD, config.wifi_password, PASSWORD_MAX_LEN);
-    readString(OFFSET_API_KEY, config.api_key, API_KEY_MAX_LEN);
-    readString(OFFSET_DEVICE_NAME, config.device_name, DEVICE_NAME_MAX_LEN);
-
-    config.use_static_ip = readUint8(OFFSET_USE_STATIC_IP);
-    config.static_ip = readIPAddress(OFFSET_STATIC_IP);
-    config.gateway = readIPAddress(OFFSET_GATEWAY);
-    config.subnet = readIPAddress(OFFSET_SUBNET);
-    config.dns_primary = readIPAddress(OFFSET_DNS_PRIMARY);
-    config.dns_secondary = readIPAddress(OFFSET_DNS_SECONDARY);
-
-    config.jpeg_quality = readUint8(OFFSET_JPEG_QUALITY);
-    config.default_resolution = (framesize_t)readUint8(OFFSET_DEFAULT_RESOLUTION);
-    config.flash_threshold = readUint8(OFFSET_FLASH_THRESHOLD);
-
-    // Older versions did not persist WiFi bandwidth.
-    if (version >= 5) {
-      config.wifi_bandwidth = readUint8(OFFSET_WIFI_BANDWIDTH);
-    } else {
-      config.wifi_bandwidth = DEFAULT_WIFI_BANDWIDTH;
-    }
-
-    if (!validateConfiguration()) {
-      Serial.println("Migrated configuration validation failed, using defaults");
-      resetToDefaults();
-      return saveConfig();
+  if (prefs.isKey("version")) {
+    if (loadFromNVS()) {
+      return true;
     }
+    Serial.println("NVS configuration validation failed, using defaults");
+    resetToDefaults();
+    return saveConfig();
+  }
 
-    config_loaded = true;
-    if (!saveConfig()) {
-      Serial.println("Failed to persist migrated configuration");
-      return false;
-    }
-    Serial.println("Config migration successful - credentials preserved");
+  // No NVS config yet - try a one-time import of the legacy EEPROM image
+  // so upgrading devices keep their credentials
+  if (migrateFromEEPROM()) {
     return true;
   }
 
-  if (magic != CONFIG_MAGIC || version != CONFIG_VERSION) {
-    Serial.printf("Invalid config magic=0x%04X version=%d, using defaults\n",
-                  magic, version);
-    resetToDefaults();
-    return saveConfig(); // Save defaults to EEPROM
+  Serial.println("No stored configuration, using defaults");
+  resetToDefaults();
+  return saveConfig();
+}
+
+bool ConfigManager::loadFromNVS() {
+  prefs.getString("wifi_ssid", config.wifi_ssid, SSID_MAX_LEN);
+  prefs.getString("wifi_pass", config.wifi_password, PASSWORD_MAX_LEN);
+  prefs.getString("api_key", config.api_key, API_KEY_MAX_LEN);
+  prefs.getString("dev_name", config.device_name, DEVICE_NAME_MAX_LEN);
+
+  config.use_static_ip = prefs.getBool("use_static", false);
+  config.static_ip = IPAddress(prefs.getUInt("static_ip", 0));
+  config.gateway = IPAddress(prefs.getUInt("gateway", 0));
+  config.subnet = IPAddress(prefs.getUInt("subnet", 0));
+  config.dns_primary = IPAddress(prefs.getUInt("dns1", 0));
+  config.dns_secondary = IPAddress(prefs.getUInt("dns2", 0));
+
+  config.jpeg_quality = prefs.getUChar("jpeg_q", DEFAULT_JPEG_QUALITY);
+  config.default_resolution =
+      (framesize_t)prefs.getUChar("def_res", (uint8_t)DEFAULT_RESOLUTION);
+  config.flash_threshold =
+      prefs.getUChar("flash_thr", DEFAULT_FLASH_THRESHOLD);
+  config.wifi_bandwidth = prefs.getUChar("wifi_bw", DEFAULT_WIFI_BANDWIDTH);
+
+  if (!validateConfiguration()) {
+    return false;
   }
 
-  // Load configuration from EEPROM
+  persisted = config;
+  config_loaded = true;
+  Serial.println("Configuration loaded successfully");
+  Serial.printf("WiFi SSID: %s\n", config.wifi_ssid);
+  Serial.printf("Device Name: %s\n", config.device_name);
+  Serial.printf("Static IP: %s\n",
+                config.use_static_ip ? "Enabled" : "Disabled");
+
+  return true;
+}
+
+/**
+ * One-time import of a legacy EEPROM-emulation config image into NVS.
+ * Returns false when no valid legacy image exists.
+ */
+bool ConfigManager::migrateFromEEPROM() {
+  if (!EEPROM.begin(EEPROM_SIZE)) {
+    return false;
+  }
+
+  uint16_t magic = readUint16(OFFSET_MAGIC);
+  uint16_t version = readUint16(OFFSET_VERSION);
+
+  // Any EEPROM layout since v1 shares the core field offsets
+  if (magic != CONFIG_MAGIC || version == 0 || version > CONFIG_VERSION) {
+    EEPROM.end();
+    return false;
+  }
+
+  Serial.printf("Migrating EEPROM config v%d to NVS...\n", version);
+
   readString(OFFSET_WIFI_SSID, config.wifi_ssid, SSID_MAX_LEN);
   readString(OFFSET_WIFI_PASSWORD, config.wifi_password, PASSWORD_MAX_LEN);
   readString(OFFSET_API_KEY, config.api_key, API_KEY_MAX_LEN);
@@ -87,55 +121,111 @@ bool ConfigManager::loadConfig() {
   config.jpeg_quality = readUint8(OFFSET_JPEG_QUALITY);
   config.default_resolution = (framesize_t)readUint8(OFFSET_DEFAULT_RESOLUTION);
   config.flash_threshold = readUint8(OFFSET_FLASH_THRESHOLD);
-  config.wifi_bandwidth = readUint8(OFFSET_WIFI_BANDWIDTH);
+
+  // Older versions did not persist WiFi bandwidth.
+  if (version >= 5) {
+    config.wifi_bandwidth = readUint8(OFFSET_WIFI_BANDWIDTH);
+  } else {
+    config.wifi_bandwidth = DEFAULT_WIFI_BANDWIDTH;
+  }
+
+  EEPROM.end();
 
   if (!validateConfiguration()) {
-    Serial.println("Configuration validation failed, using defaults");
-    resetToDefaults();
-    return saveConfig();
+    Serial.println("Migrated configuration validation failed");
+    return false;
   }
 
   config_loaded = true;
-  Serial.println("Configuration loaded successfully");
-  Serial.printf("WiFi SSID: %s\n", config.wifi_ssid);
-  Serial.printf("Device Name: %s\n", config.device_name);
-  Serial.printf("Static IP: %s\n",
-                config.use_static_ip ? "Enabled" : "Disabled");
-
+  if (!saveConfig()) {
+    Serial.println("Failed to persist migrated configuration");
+    return false;
+  }
+  Serial.println("Config migration successful - credentials preserved");
   return true;
 }
 
 bool ConfigManager::saveConfig() {
-  Serial.println("Saving configuration to EEPROM...");
-
-  // Write magic number and version
-  writeUint16(OFFSET_MAGIC, CONFIG_MAGIC);
-  writeUint16(OFFSET_VERSION, CONFIG_VERSION);
-
-  // Write configuration data
-  writeString(OFFSET_WIFI_SSID, config.wifi_ssid, SSID_MAX_LEN);
-  writeString(OFFSET_WIFI_PASSWORD, config.wifi_password, PASSWORD_MAX_LEN);
-  writeString(OFFSET_API_KEY, config.api_key, API_KEY_MAX_LEN);
-  writeString(OFFSET_DEVICE_NAME, config.device_name, DEVICE_NAME_MAX_LEN);
-
-  writeUint8(OFFSET_USE_STATIC_IP, config.use_static_ip ? 1 : 0);
-  writeIPAddress(OFFSET_STATIC_IP, config.static_ip);
-  writeIPAddress(OFFSET_GATEWAY, config.gateway);
-  writeIPAddress(OFFSET_SUBNET, config.subnet);
-  writeIPAddress(OFFSET_DNS_PRIMARY, config.dns_primary);
-  writeIPAddress(OFFSET_DNS_SECONDARY, config.dns_secondary);
-
-  writeUint8(OFFSET_JPEG_QUALITY, config.jpeg_quality);
-  writeUint8(OFFSET_DEFAULT_RESOLUTION, (uint8_t)config.default_resolution);
-  writeUint8(OFFSET_FLASH_THRESHOLD, config.flash_threshold);
-  writeUint8(OFFSET_WIFI_BANDWIDTH, config.wifi_bandwidth);
-
-  if (!EEPROM.commit()) {
-    Serial.println("Failed to commit EEPROM changes");
+  // Per-key dirty writes: only fields that differ from what NVS already
+  // holds touch flash, so a one-byte bandwidth change is one small NVS
+  // entry instead of a full 512-byte page erase+write, and a no-op save
+  // returns in microseconds
+  bool ok = true;
+
+  if (strcmp(config.wifi_ssid, persisted.wifi_ssid) != 0 ||
+      !prefs.isKey("wifi_ssid")) {
+    ok &= prefs.putString("wifi_ssid", config.wifi_ssid) ==
+              strlen(config.wifi_ssid) ||
+          strlen(config.wifi_ssid) == 0;
+  }
+  if (strcmp(config.wifi_password, persisted.wifi_password) != 0 ||
+      !prefs.isKey("wifi_pass")) {
+    ok &= prefs.putString("wifi_pass", config.wifi_password) ==
+              strlen(config.wifi_password) ||
+          strlen(config.wifi_password) == 0;
+  }
+  if (strcmp(config.api_key, persisted.api_key) != 0 ||
+      !prefs.isKey("api_key")) {
+    ok &= prefs.putString("api_key", config.api_key) ==
+              strlen(config.api_key) ||
+          strlen(config.api_key) == 0;
+  }
+  if (strcmp(config.device_name, persisted.device_name) != 0 ||
+      !prefs.isKey("dev_name")) {
+    ok &= prefs.putString("dev_name", config.device_name) ==
+              strlen(config.device_name) ||
+          strlen(config.device_name) == 0;
+  }
+
+  if (config.use_static_ip != persisted.use_static_ip ||
+      !prefs.isKey("use_static")) {
+    prefs.putBool("use_static", config.use_static_ip);
+  }
+  if ((uint32_t)config.static_ip != (uint32_t)persisted.static_ip || !prefs.isKey("static_ip")) {
+    prefs.putUInt("static_ip", (uint32_t)config.static_ip);
+  }
+  if ((uint32_t)config.gateway != (uint32_t)persisted.gateway || !prefs.isKey("gateway")) {
+    prefs.putUInt("gateway", (uint32_t)config.gateway);
+  }
+  if ((uint32_t)config.subnet != (uint32_t)persisted.subnet || !prefs.isKey("subnet")) {
+    prefs.putUInt("subnet", (uint32_t)config.subnet);
+  }
+  if ((uint32_t)config.dns_primary != (uint32_t)persisted.dns_primary || !prefs.isKey("dns1")) {
+    prefs.putUInt("dns1", (uint32_t)config.dns_primary);
+  }
+  if ((uint32_t)config.dns_secondary != (uint32_t)persisted.dns_secondary ||
+      !prefs.isKey("dns2")) {
+    prefs.putUInt("dns2", (uint32_t)config.dns_secondary);
+  }
+
+  if (config.jpeg_quality != persisted.jpeg_quality ||
+      !prefs.isKey("jpeg_q")) {
+    prefs.putUChar("jpeg_q", config.jpeg_quality);
+  }
+  if (config.default_resolution != persisted.default_resolution ||
+      !prefs.isKey("def_res")) {
+    prefs.putUChar("def_res", (uint8_t)config.default_resolution);
+  }
+  if (config.flash_threshold != persisted.flash_threshold ||
+      !prefs.isKey("flash_thr")) {
+    prefs.putUChar("flash_thr", config.flash_threshold);
+  }
+  if (config.wifi_bandwidth != persisted.wifi_bandwidth ||
+      !prefs.isKey("wifi_bw")) {
+    prefs.putUChar("wifi_bw", config.wifi_bandwidth);
+  }
+
+  if (!prefs.isKey("version")) {
+    prefs.putUShort("version", CONFIG_VERSION);
+  }
+
+  if (!ok) {
+    Serial.println("Failed to write configuration to NVS");
     return false;
   }
 
-  Serial.println("Configuration saved successfully");
+  persisted = config;
+  config_loaded = true;
   return true;
 }
 
@@ -282,8 +372,7 @@ bool ConfigManager::isAPIKeyValid(const char *provided_key) const {
 }
 
 bool ConfigManager::isFirstBoot() const {
-  uint16_t magic = const_cast<ConfigManager *>(this)->readUint16(OFFSET_MAGIC);
-  return magic != CONFIG_MAGIC;
+  return !const_cast<ConfigManager *>(this)->prefs.isKey("version");
 }
 
 void ConfigManager::enterConfigMode() {
@@ -311,21 +400,7 @@ void ConfigManager::exitConfigMode() {
   }
 }
 
-// Private helper methods
-void ConfigManager::writeString(int offset, const char *str, int max_len) {
-  int len = strlen(str);
-  if (len >= max_len)
-    len = max_len - 1;
-
-  for (int i = 0; i < len; i++) {
-    EEPROM.write(offset + i, str[i]);
-  }
-  // Null terminate
-  for (int i = len; i < max_len; i++) {
-    EEPROM.write(offset + i, 0);
-  }
-}
-
+// Private helper methods (legacy EEPROM image readers, migration only)
 void ConfigManager::readString(int offset, char *str, int max_len) {
   for (int i = 0; i < max_len; i++) {
     str[i] = EEPROM.read(offset + i);
@@ -335,29 +410,14 @@ void ConfigManager::readString(int offset, char *str, int max_len) {
   str[max_len - 1] = '\0'; // Ensure null termination
 }
 
-void ConfigManager::writeUint8(int offset, uint8_t value) {
-  EEPROM.write(offset, value);
-}
-
 uint8_t ConfigManager::readUint8(int offset) { return EEPROM.read(offset); }
 
-void ConfigManager::writeUint16(int offset, uint16_t value) {
-  EEPROM.write(offset, value & 0xFF);
-  EEPROM.write(offset + 1, (value >> 8) & 0xFF);
-}
-
 uint16_t ConfigManager::readUint16(int offset) {
   uint16_t value = EEPROM.read(offset);
   value |= (EEPROM.read(offset + 1) << 8);
   return value;
 }
 
-void ConfigManager::writeIPAddress(int offset, const IPAddress &addr) {
-  for (int i = 0; i < 4; i++) {
-    EEPROM.write(offset + i, addr[i]);
-  }
-}
-
 IPAddress ConfigManager::readIPAddress(int offset) {
   return IPAddress(EEPROM.read(offset), EEPROM.read(offset + 1),
                    EEPROM.read(offset + 2), EEPROM.read(offset + 3));
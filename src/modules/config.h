@@ -3,16 +3,22 @@
 
 #include "esp_camera.h"
 #include <Arduino.h>
-#include <EEPROM.h>
+#include <EEPROM.h> // Legacy image import only - live storage is NVS
+#include <Preferences.h>
 #include <WiFi.h>
 #include "credentials.h"
 
-// EEPROM Memory Layout
+// Configuration lives in ESP-IDF NVS (namespace "esp32cam") with one key
+// per field, so saves only touch flash for fields that actually changed.
+#define CONFIG_NVS_NAMESPACE "esp32cam"
+#define CONFIG_VERSION 6
+
+// Legacy EEPROM image layout, kept only so a device upgrading from the
+// EEPROM-based firmware imports its existing settings once
 #define EEPROM_SIZE 512
 #define CONFIG_MAGIC 0xFFFF
-#define CONFIG_VERSION 6
 
-// Memory offsets
+// Memory offsets (legacy EEPROM image)
 #define OFFSET_MAGIC 0
 #define OFFSET_VERSION 2
 #define OFFSET_WIFI_SSID 4
@@ -81,6 +87,14 @@ public:
   bool saveConfig();
   void resetToDefaults();
 
+  // Deferred commit: handlers update the in-RAM Configuration and mark it
+  // dirty; loop() drains the flag with commitPendingSave() when no capture
+  // is in flight, so HTTP responses never wait on a flash write and NVS
+  // writes never collide with active frame DMA
+  void requestSave() { save_pending = true; }
+  bool hasPendingSave() const { return save_pending; }
+  bool commitPendingSave();
+
   // Getters
   const Configuration &getConfig() const { return config; }
   const char *getWiFiSSID() const { return config.wifi_ssid; }
@@ -115,6 +129,15 @@ public:
   bool isValidConfig() const;
   bool isAPIKeyValid(const char *provided_key) const;
 
+  // Fast-boot state: whether the camera initialized cleanly last boot, so
+  // setup() can skip the probe/retry delays on known-good hardware
+  bool getCameraInitOK() { return prefs.getBool("cam_ok", false); }
+  void setCameraInitOK(bool ok) {
+    if (ok != prefs.getBool("cam_ok", false)) {
+      prefs.putBool("cam_ok", ok);
+    }
+  }
+
   // Configuration mode (for initial setup)
   bool isFirstBoot() const;
   void enterConfigMode();
@@ -122,15 +145,20 @@ public:
 
 private:
   Configuration config;
+  // Shadow of what NVS currently holds - saveConfig() diffs against it so
+  // unchanged fields never touch flash
+  Configuration persisted;
+  Preferences prefs;
   bool config_loaded;
+  volatile bool save_pending;
+
+  bool loadFromNVS();
+  bool migrateFromEEPROM();
 
-  void writeString(int offset, const char *str, int max_len);
+  // Legacy EEPROM image readers (migration only)
   void readString(int offset, char *str, int max_len);
-  void writeUint8(int offset, uint8_t value);
   uint8_t readUint8(int offset);
-  void writeUint16(int offset, uint16_t value);
   uint16_t readUint16(int offset);
-  void writeIPAddress(int offset, const IPAddress &addr);
   IPAddress readIPAddress(int offset);
   bool validateConfiguration() const;
 };
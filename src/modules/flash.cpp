@@ -12,7 +12,9 @@ FlashManager::FlashManager() :
   last_light_check(0),
   cached_light_result(true),
   activation_count(0),
-  last_activation_time(0) {
+  last_activation_time(0),
+  last_frame_brightness(0),
+  has_frame_brightness(false) {
 }
 
 bool FlashManager::begin(uint8_t threshold) {
@@ -245,12 +247,62 @@ void FlashManager::prepareForCapture() {
 
 void FlashManager::finishCapture() {
   if (!flash_ready) return;
-  
+
   // Turn off flash after capture if it was auto-activated
   // This provides a clean end to the capture process
   Serial.println("Flash capture finished");
 }
 
+void FlashManager::finishCapture(camera_fb_t* fb) {
+  // Cache the captured frame's brightness so the next flash capture can
+  // meter its duty and settle time instead of using fixed values
+  if (fb && fb->len >= 1000) {
+    last_frame_brightness = analyzeBrightness(fb);
+    has_frame_brightness = true;
+  }
+  finishCapture();
+}
+
+/**
+ * Pick a flash duty preset from the previous frame's measured brightness.
+ * Falls back to FLASH_MEDIUM when no measurement exists yet.
+ */
+uint8_t FlashManager::meterFlashDuty() {
+  if (!has_frame_brightness) {
+    return FLASH_MEDIUM;
+  }
+
+  // Scale against the configured light threshold: well above it the scene
+  // doesn't need the LED at all, well below it needs everything we have
+  if (last_frame_brightness >= light_threshold + (light_threshold / 2)) {
+    return FLASH_OFF;
+  }
+  if (last_frame_brightness >= light_threshold) {
+    return FLASH_LOW;
+  }
+  if (last_frame_brightness >= light_threshold / 2) {
+    return FLASH_MEDIUM;
+  }
+  return FLASH_HIGH;
+}
+
+/**
+ * Settle time matching a metered duty: bright scenes skip the delay
+ * entirely, dim ones get progressively longer LED/AE stabilization
+ */
+uint16_t FlashManager::meterSettleTime(uint8_t duty) const {
+  if (duty == FLASH_OFF) {
+    return 0;
+  }
+  if (duty <= FLASH_LOW) {
+    return FLASH_SETTLE_SHORT_MS;
+  }
+  if (duty <= FLASH_MEDIUM) {
+    return FLASH_SETTLE_MEDIUM_MS;
+  }
+  return FLASH_SETTLE_FULL_MS;
+}
+
 bool FlashManager::captureWithAutoFlash(camera_fb_t** fb) {
   if (!flash_ready || !fb) {
     return false;
@@ -258,23 +310,33 @@ bool FlashManager::captureWithAutoFlash(camera_fb_t** fb) {
   
   // Check if flash is needed
   bool use_flash = shouldUseFlash();
-  
+
+  uint8_t duty = FLASH_OFF;
   if (use_flash) {
-    Serial.println("Auto-flash: Activating flash for low light");
-    setFlashDuty(FLASH_MEDIUM);
-    delay(200); // Stabilization delay
+    duty = meterFlashDuty();
+    Serial.printf("Auto-flash: Activating flash for low light (duty=%d)\n",
+                  duty);
+    setFlashDuty(duty);
+    uint16_t settle = meterSettleTime(duty);
+    if (settle > 0) {
+      delay(settle);
+    }
   }
-  
+
   // Capture frame using CameraManager
   *fb = cameraManager.captureFrame();
-  
+
   if (use_flash) {
-    // Keep flash on briefly for exposure, then turn off
-    delay(100);
     setFlashDuty(FLASH_OFF);
     Serial.println("Auto-flash: Deactivated after capture");
   }
-  
+
+  // Meter only LED-off frames so the loop tracks ambient light rather than
+  // its own output
+  if (*fb && duty == FLASH_OFF) {
+    finishCapture(*fb);
+  }
+
   return (*fb != nullptr);
 }
 
@@ -17,6 +17,12 @@
 #define FLASH_MEDIUM      128
 #define FLASH_HIGH        255
 
+// Metered settle times: brighter scenes need less LED ramp/AE time, and a
+// scene bright enough to skip the flash needs none at all
+#define FLASH_SETTLE_SHORT_MS   60
+#define FLASH_SETTLE_MEDIUM_MS  120
+#define FLASH_SETTLE_FULL_MS    200
+
 enum FlashMode {
   FLASH_MODE_OFF = 0,
   FLASH_MODE_ON = 1,
@@ -48,6 +54,7 @@ public:
   bool isFlashOn() const { return current_duty > 0; }
   
   // Light detection
+  uint8_t measureBrightness(camera_fb_t* fb) { return analyzeBrightness(fb); }
   bool isLightLow();
   bool isLightLow(camera_fb_t* fb);
   uint8_t getLastLightLevel() const { return last_light_level; }
@@ -66,8 +73,15 @@ public:
   // Synchronized capture support
   void prepareForCapture();
   void finishCapture();
+  void finishCapture(camera_fb_t* fb); // Also meters the frame for next time
   bool captureWithAutoFlash(camera_fb_t** fb);
 
+  // Adaptive metering: pick a duty preset and settle time from the
+  // previous frame's measured brightness instead of a fixed
+  // FLASH_MEDIUM + 200 ms for every capture
+  uint8_t meterFlashDuty();
+  uint16_t meterSettleTime(uint8_t duty) const;
+
 private:
   bool flash_ready;
   uint8_t current_duty;
@@ -77,7 +91,11 @@ private:
   bool cached_light_result;
   uint32_t activation_count;
   unsigned long last_activation_time;
-  
+
+  // Brightness of the most recent captured frame (metering input)
+  uint8_t last_frame_brightness;
+  bool has_frame_brightness;
+
   // Internal methods
   bool initializePWM();
   uint8_t analyzeBrightness(camera_fb_t* fb);
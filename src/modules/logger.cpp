@@ -0,0 +1,83 @@
+#include "logger.h"
+
+#include <stdarg.h>
+
+// Global instance
+LogManager logManager;
+
+LogManager::LogManager() : head(0), drain_pos(0) {
+  mux = portMUX_INITIALIZER_UNLOCKED;
+  memset(ring, 0, sizeof(ring));
+}
+
+void LogManager::write(const char *data, size_t len) {
+  if (len > LOG_RING_SIZE) {
+    // Keep only the tail of an oversized burst
+    data += len - LOG_RING_SIZE;
+    len = LOG_RING_SIZE;
+  }
+
+  portENTER_CRITICAL(&mux);
+  for (size_t i = 0; i < len; i++) {
+    ring[(head + i) % LOG_RING_SIZE] = data[i];
+  }
+  head += len;
+  // Drop undrained bytes the ring has already overwritten
+  if (head - drain_pos > LOG_RING_SIZE) {
+    drain_pos = head - LOG_RING_SIZE;
+  }
+  portEXIT_CRITICAL(&mux);
+}
+
+void LogManager::printf(const char *fmt, ...) {
+  char line[LOG_LINE_MAX];
+  va_list args;
+  va_start(args, fmt);
+  int len = vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+
+  if (len <= 0) {
+    return;
+  }
+  if (len >= (int)sizeof(line)) {
+    len = sizeof(line) - 1;
+  }
+  write(line, len);
+}
+
+void LogManager::println(const char *msg) {
+  write(msg, strlen(msg));
+  write("\n", 1);
+}
+
+void LogManager::drain() {
+  // Bounded by both the per-call budget and the UART TX buffer so a log
+  // burst drains over several idle passes instead of blocking one
+  int budget = LOG_DRAIN_BUDGET;
+  while (budget > 0 && drain_pos < head && Serial.availableForWrite() > 0) {
+    portENTER_CRITICAL(&mux);
+    if (head - drain_pos > LOG_RING_SIZE) {
+      drain_pos = head - LOG_RING_SIZE;
+    }
+    char c = ring[drain_pos % LOG_RING_SIZE];
+    drain_pos = drain_pos + 1;
+    portEXIT_CRITICAL(&mux);
+
+    Serial.write(c);
+    budget--;
+  }
+}
+
+void LogManager::writeTo(Print &out) {
+  // Snapshot the counters, then dump the retained window oldest-first.
+  // Writers may append while we stream; anything newer than the snapshot
+  // just shows up in the next fetch.
+  portENTER_CRITICAL(&mux);
+  uint32_t end = head;
+  uint32_t start = end > LOG_RING_SIZE ? end - LOG_RING_SIZE : 0;
+  portEXIT_CRITICAL(&mux);
+
+  for (uint32_t pos = start; pos < end; pos++) {
+    out.write((uint8_t)ring[pos % LOG_RING_SIZE]);
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+
+// Deferred logging: hot paths format into a ring buffer with a cheap
+// memcpy and move on; the 115200-baud UART write happens later from idle
+// time in loop(). GET /logs serves the retained ring remotely, so reading
+// logs no longer needs a USB cable at the site.
+
+#define LOG_RING_SIZE 4096
+#define LOG_LINE_MAX 256
+#define LOG_DRAIN_BUDGET 256 // Max bytes pushed to the UART per drain call
+
+class LogManager {
+public:
+  LogManager();
+
+  // Hot-path writers: format and copy into the ring, never touch the UART
+  void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+  void println(const char *msg);
+
+  // Push pending bytes to Serial from idle time; bounded per call and by
+  // the UART's TX buffer so it never blocks
+  void drain();
+
+  // Dump the retained ring (oldest first) - backs GET /logs
+  void writeTo(Print &out);
+
+private:
+  void write(const char *data, size_t len);
+
+  char ring[LOG_RING_SIZE];
+  // Absolute byte counters; ring[pos % LOG_RING_SIZE] holds byte `pos`.
+  // The ring retains the newest LOG_RING_SIZE bytes, head - drain_pos of
+  // which are still waiting for the UART.
+  volatile uint32_t head;
+  volatile uint32_t drain_pos;
+  portMUX_TYPE mux;
+};
+
+// Global log manager instance
+extern LogManager logManager;
+
+#endif // LOGGER_H
@@ -0,0 +1,92 @@
+#include "metrics.h"
+#include "camera.h"
+#include "webserver.h"
+#include "esp_heap_caps.h"
+#include "esp_system.h"
+
+// Global instance
+MetricsManager metricsManager;
+
+// Upper bounds (ms) for the latency buckets; spans sub-ms parses up to
+// multi-second captures on a weak link
+static const uint32_t BUCKET_BOUNDS_MS[METRICS_BUCKET_COUNT] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000};
+
+static const char *METRIC_NAMES[METRIC_COUNT] = {
+    "esp32cam_capture_ms",
+    "esp32cam_settings_apply_ms",
+    "esp32cam_http_parse_ms",
+    "esp32cam_socket_write_ms",
+};
+
+MetricsManager::MetricsManager() {
+  memset(histograms, 0, sizeof(histograms));
+}
+
+void MetricsManager::recordLatency(MetricId id, uint32_t elapsed_ms) {
+  if (id >= METRIC_COUNT) {
+    return;
+  }
+
+  Histogram &h = histograms[id];
+  for (int i = 0; i < METRICS_BUCKET_COUNT; i++) {
+    if (elapsed_ms <= BUCKET_BOUNDS_MS[i]) {
+      h.buckets[i]++;
+    }
+  }
+  h.count++;
+  h.sum_ms += elapsed_ms;
+}
+
+void MetricsManager::writeHistogram(Print &out, const char *name,
+                                    const Histogram &h) {
+  out.printf("# TYPE %s histogram\n", name);
+  for (int i = 0; i < METRICS_BUCKET_COUNT; i++) {
+    out.printf("%s_bucket{le=\"%u\"} %u\n", name, BUCKET_BOUNDS_MS[i],
+               h.buckets[i]);
+  }
+  out.printf("%s_bucket{le=\"+Inf\"} %u\n", name, h.count);
+  out.printf("%s_sum %llu\n", name, h.sum_ms);
+  out.printf("%s_count %u\n", name, h.count);
+}
+
+void MetricsManager::writePrometheus(Print &out) {
+  for (int i = 0; i < METRIC_COUNT; i++) {
+    writeHistogram(out, METRIC_NAMES[i], histograms[i]);
+  }
+
+  // Heap gauges - min free heap is the high-water mark the watchdog reboot
+  // threshold cares about
+  out.printf("# TYPE esp32cam_free_heap_bytes gauge\n"
+             "esp32cam_free_heap_bytes %u\n",
+             esp_get_free_heap_size());
+  out.printf("# TYPE esp32cam_min_free_heap_bytes gauge\n"
+             "esp32cam_min_free_heap_bytes %u\n",
+             esp_get_minimum_free_heap_size());
+  out.printf("# TYPE esp32cam_largest_free_block_bytes gauge\n"
+             "esp32cam_largest_free_block_bytes %u\n",
+             heap_caps_get_largest_free_block(MALLOC_CAP_DMA));
+
+  // Counters already tracked by the managers
+  out.printf("# TYPE esp32cam_captures_total counter\n"
+             "esp32cam_captures_total %u\n",
+             cameraManager.getTotalCaptureCount());
+  out.printf("# TYPE esp32cam_capture_failures_total counter\n"
+             "esp32cam_capture_failures_total %u\n",
+             cameraManager.getFailedCaptureCount());
+  out.printf("# TYPE esp32cam_http_requests_total counter\n"
+             "esp32cam_http_requests_total %u\n",
+             webServerManager.getTotalRequests());
+  out.printf("# TYPE esp32cam_http_errors_total counter\n"
+             "esp32cam_http_errors_total %u\n",
+             webServerManager.getErrorRequests());
+
+  out.printf("# TYPE esp32cam_uptime_seconds counter\n"
+             "esp32cam_uptime_seconds %lu\n",
+             millis() / 1000);
+
+  // WiFi signal - the usual first suspect when a unit degrades
+  out.printf("# TYPE esp32cam_wifi_rssi_dbm gauge\n"
+             "esp32cam_wifi_rssi_dbm %d\n",
+             WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0);
+}
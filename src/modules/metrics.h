@@ -0,0 +1,48 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+// On-device instrumentation: cheap monotonic histograms recorded from the
+// hot paths (capture, sensor reconfig, HTTP parse, socket write) plus heap
+// gauges, exported as Prometheus text from GET /metrics.
+
+// Histogram bucket upper bounds in milliseconds (+Inf is implicit)
+#define METRICS_BUCKET_COUNT 12
+
+enum MetricId {
+  METRIC_CAPTURE = 0,       // captureFrame() sensor acquisition
+  METRIC_SETTINGS_APPLY,    // applySettings() sensor reconfiguration
+  METRIC_HTTP_PARSE,        // Request first-byte to parse complete
+  METRIC_SOCKET_WRITE,      // sendResponse() header + body write
+  METRIC_COUNT
+};
+
+class MetricsManager {
+public:
+  MetricsManager();
+
+  // Record one observation; a handful of compares and increments, safe to
+  // call from any task
+  void recordLatency(MetricId id, uint32_t elapsed_ms);
+
+  // Write the full Prometheus text exposition (histograms, gauges and the
+  // counters tracked by the camera and web server managers)
+  void writePrometheus(Print &out);
+
+private:
+  struct Histogram {
+    uint32_t buckets[METRICS_BUCKET_COUNT]; // Cumulative per-le counts
+    uint32_t count;
+    uint64_t sum_ms;
+  };
+
+  Histogram histograms[METRIC_COUNT];
+
+  void writeHistogram(Print &out, const char *name, const Histogram &h);
+};
+
+// Global metrics manager instance
+extern MetricsManager metricsManager;
+
+#endif // METRICS_H
@@ -0,0 +1,62 @@
+#ifndef MOTION_H
+#define MOTION_H
+
+#include <Arduino.h>
+#include "esp_camera.h"
+
+// Motion detection: a low-priority background task samples the newest
+// continuous-capture ring frame, reduces it to a small block signature and
+// diffs successive signatures - clients long-poll /motion/wait and fetch
+// full frames only on events instead of polling JPEGs at 1 fps.
+
+#define MOTION_BLOCK_COUNT 16
+#define MOTION_CHECK_INTERVAL_MS 500
+#define MOTION_BLOCK_DELTA_THRESHOLD 6 // Per-block average delta to count
+#define MOTION_BLOCKS_FOR_EVENT 3      // Changed blocks that make an event
+#define MOTION_LENGTH_RATIO_PERCENT 12 // JPEG size change that makes an event
+#define MOTION_HOLD_MS 5000            // "detected" stays set after an event
+#define MOTION_TASK_CORE 1
+#define MOTION_TASK_STACK_SIZE 3072
+#define MOTION_TASK_PRIORITY 1
+
+class MotionManager {
+public:
+  MotionManager();
+
+  // Spawns the detection task; requires the camera's continuous capture
+  // ring to be running (frames are read from it, never captured here)
+  bool begin();
+  void stop();
+  bool isActive() const { return task_handle != nullptr; }
+
+  // Motion state
+  bool isMotionDetected() const;
+  uint8_t getLastScore() const { return last_score; }
+  uint32_t getMotionEventCount() const { return motion_events; }
+  unsigned long getLastMotionTime() const { return last_motion_time; }
+
+  void notifyTaskExit() { task_handle = nullptr; }
+  void detectionLoop(); // Task body, do not call directly
+
+private:
+  void analyzeFrame(const uint8_t *buf, size_t len);
+
+  TaskHandle_t task_handle;
+  volatile bool running;
+
+  // Block signature of the previous frame (sampled byte averages over the
+  // entropy-coded JPEG data - the same cheap sampling approach as
+  // FlashManager::analyzeBrightness, just per block)
+  uint8_t prev_signature[MOTION_BLOCK_COUNT];
+  size_t prev_len;
+  bool has_signature;
+
+  volatile uint8_t last_score;
+  volatile uint32_t motion_events;
+  volatile unsigned long last_motion_time;
+};
+
+// Global motion manager instance
+extern MotionManager motionManager;
+
+#endif // MOTION_H
@@ -0,0 +1,325 @@
+#include "recorder.h"
+#include "camera.h"
+#include "logger.h"
+#include "esp_task_wdt.h"
+#include <SD_MMC.h>
+
+// Global instance
+RecorderManager recorderManager;
+
+RecorderManager::RecorderManager()
+    : task_handle(nullptr), running(false), card_mounted(false),
+      write_offset(0), index_head(0), index_count(0), frames_since_flush(0),
+      frames_recorded(0), frames_dropped(0), last_spooled_timestamp(0) {
+  memset(index, 0, sizeof(index));
+  recorder_mutex = xSemaphoreCreateMutex();
+}
+
+/**
+ * Entry point for the spooler task
+ */
+static void recorderTask(void *param) {
+  RecorderManager *manager = (RecorderManager *)param;
+
+  esp_task_wdt_add(NULL);
+  manager->spoolLoop();
+  esp_task_wdt_delete(NULL);
+
+  manager->notifyTaskExit();
+  vTaskDelete(NULL);
+}
+
+bool RecorderManager::begin() {
+  if (task_handle) {
+    return true; // Already running
+  }
+  if (!cameraManager.isContinuousCaptureActive()) {
+    Serial.println("Cannot start recorder: continuous capture off");
+    return false;
+  }
+
+  // 1-bit mode: 4-bit SD_MMC claims GPIO4, which is the flash LED
+  if (!card_mounted && !SD_MMC.begin(RECORDER_MOUNT_POINT, true)) {
+    Serial.println("Recorder: no SD card detected, recording disabled");
+    return false;
+  }
+  card_mounted = true;
+
+  if (!SD_MMC.exists(RECORDER_DIR)) {
+    SD_MMC.mkdir(RECORDER_DIR);
+  }
+
+  loadIndex();
+
+  if (!openDataFile()) {
+    Serial.println("Recorder: failed to open data file");
+    return false;
+  }
+
+  running = true;
+  BaseType_t created = xTaskCreatePinnedToCore(
+      recorderTask, "recorder", RECORDER_TASK_STACK_SIZE, this,
+      RECORDER_TASK_PRIORITY, &task_handle, RECORDER_TASK_CORE);
+
+  if (created != pdPASS) {
+    task_handle = nullptr;
+    running = false;
+    Serial.println("Failed to create recorder task");
+    return false;
+  }
+
+  Serial.printf("Recorder spooling to SD (%llu MB card, %u frames indexed)\n",
+                SD_MMC.cardSize() / (1024 * 1024), index_count);
+  return true;
+}
+
+void RecorderManager::stop() {
+  running = false;
+  unsigned long stop_start = millis();
+  while (task_handle && (millis() - stop_start) < 2000) {
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+
+  xSemaphoreTake(recorder_mutex, portMAX_DELAY);
+  flushIndex();
+  if (data_file) {
+    data_file.close();
+  }
+  xSemaphoreGive(recorder_mutex);
+}
+
+bool RecorderManager::openDataFile() {
+  // Reopen in r+ so the circular wrap can seek backwards; create first if
+  // the file doesn't exist yet
+  if (!SD_MMC.exists(RECORDER_DATA_FILE)) {
+    File create = SD_MMC.open(RECORDER_DATA_FILE, FILE_WRITE);
+    if (!create) {
+      return false;
+    }
+    create.close();
+  }
+
+  data_file = SD_MMC.open(RECORDER_DATA_FILE, "r+");
+  if (!data_file) {
+    return false;
+  }
+  data_file.seek(write_offset);
+  return true;
+}
+
+/**
+ * Background task body: copy each new ring frame onto the card
+ */
+void RecorderManager::spoolLoop() {
+  while (running) {
+    esp_task_wdt_reset();
+
+    uint8_t *buf = nullptr;
+    size_t len = 0;
+    unsigned long timestamp = 0;
+    int ring_index = cameraManager.acquireLatestFrame(&buf, &len, &timestamp);
+    if (ring_index >= 0) {
+      // The ring holds the latest frame until a new one lands; only spool
+      // frames we haven't written yet
+      if (timestamp != last_spooled_timestamp) {
+        spoolFrame(buf, len, timestamp);
+        last_spooled_timestamp = timestamp;
+      }
+      cameraManager.releaseRingFrame(ring_index);
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(RECORDER_INTERVAL_MS));
+  }
+}
+
+void RecorderManager::spoolFrame(const uint8_t *buf, size_t len,
+                                 unsigned long timestamp) {
+  if (!data_file || len == 0) {
+    return;
+  }
+
+  xSemaphoreTake(recorder_mutex, portMAX_DELAY);
+
+  // Wrap the circular file rather than growing past the cap
+  if (write_offset + len > RECORDER_FILE_MAX_BYTES) {
+    write_offset = 0;
+    data_file.seek(0);
+  }
+
+  // Evict index entries whose data this write is about to overwrite, so a
+  // range query can never serve bytes from two different laps of the file
+  for (int i = 0; i < RECORDER_INDEX_ENTRIES; i++) {
+    FrameIndexEntry &old_entry = index[i];
+    if (old_entry.length != 0 &&
+        old_entry.offset < write_offset + len &&
+        old_entry.offset + old_entry.length > write_offset) {
+      old_entry.length = 0; // Tombstone - skipped by streamRange
+    }
+  }
+
+  size_t written = data_file.write(buf, len);
+  if (written == len) {
+    FrameIndexEntry &entry = index[index_head];
+    entry.offset = write_offset;
+    entry.length = len;
+    entry.timestamp = (uint32_t)timestamp;
+
+    index_head = (index_head + 1) % RECORDER_INDEX_ENTRIES;
+    if (index_count < RECORDER_INDEX_ENTRIES) {
+      index_count++;
+    }
+
+    write_offset += len;
+    frames_recorded++;
+
+    if (++frames_since_flush >= RECORDER_INDEX_FLUSH_FRAMES) {
+      data_file.flush();
+      flushIndex();
+      frames_since_flush = 0;
+    }
+  } else {
+    frames_dropped++;
+    logManager.printf("Recorder: short write (%u/%u bytes)\n", written, len);
+  }
+
+  xSemaphoreGive(recorder_mutex);
+}
+
+/**
+ * Persist the index ring so a reboot keeps the recorded history reachable.
+ * Caller holds recorder_mutex.
+ */
+void RecorderManager::flushIndex() {
+  File f = SD_MMC.open(RECORDER_INDEX_FILE, FILE_WRITE);
+  if (!f) {
+    return;
+  }
+  f.write((const uint8_t *)&write_offset, sizeof(write_offset));
+  f.write((const uint8_t *)&index_head, sizeof(index_head));
+  f.write((const uint8_t *)&index_count, sizeof(index_count));
+  f.write((const uint8_t *)index, sizeof(index));
+  f.close();
+}
+
+void RecorderManager::loadIndex() {
+  File f = SD_MMC.open(RECORDER_INDEX_FILE, FILE_READ);
+  if (!f) {
+    return;
+  }
+
+  bool ok = f.read((uint8_t *)&write_offset, sizeof(write_offset)) ==
+                sizeof(write_offset) &&
+            f.read((uint8_t *)&index_head, sizeof(index_head)) ==
+                sizeof(index_head) &&
+            f.read((uint8_t *)&index_count, sizeof(index_count)) ==
+                sizeof(index_count) &&
+            f.read((uint8_t *)index, sizeof(index)) == sizeof(index);
+  f.close();
+
+  if (!ok || index_head < 0 || index_head >= RECORDER_INDEX_ENTRIES ||
+      index_count < 0 || index_count > RECORDER_INDEX_ENTRIES ||
+      write_offset > RECORDER_FILE_MAX_BYTES) {
+    Serial.println("Recorder: index file invalid, starting fresh");
+    write_offset = 0;
+    index_head = 0;
+    index_count = 0;
+    memset(index, 0, sizeof(index));
+  }
+}
+
+/**
+ * Walk indexed frames within [from, to] oldest-first, feeding each through
+ * the sink in chunks read straight off the card. Returns frames delivered,
+ * or -1 when the recorder is not active.
+ */
+int RecorderManager::streamRange(uint32_t from, uint32_t to, FrameSink sink,
+                                 void *ctx) {
+  if (!card_mounted || !data_file) {
+    return -1;
+  }
+
+  int delivered = 0;
+  uint8_t chunk[2048];
+
+  for (int i = 0; i < index_count; i++) {
+    // Oldest entry sits at index_head when the ring is full
+    int pos = index_count < RECORDER_INDEX_ENTRIES
+                  ? i
+                  : (index_head + i) % RECORDER_INDEX_ENTRIES;
+    FrameIndexEntry entry;
+
+    xSemaphoreTake(recorder_mutex, portMAX_DELAY);
+    entry = index[pos];
+    xSemaphoreGive(recorder_mutex);
+
+    if (entry.length == 0 || entry.timestamp < from || entry.timestamp > to) {
+      continue;
+    }
+
+    size_t remaining = entry.length;
+    uint32_t offset = entry.offset;
+    bool first = true;
+    bool aborted = false;
+
+    while (remaining > 0) {
+      size_t to_read = remaining < sizeof(chunk) ? remaining : sizeof(chunk);
+
+      xSemaphoreTake(recorder_mutex, portMAX_DELAY);
+      // Re-check the live entry before every chunk: the spooler may have
+      // tombstoned or replaced it (the file lapped into this frame) since
+      // we copied it, and our copy wouldn't see that - abort rather than
+      // hand the client bytes from two different laps
+      if (index[pos].length != entry.length ||
+          index[pos].offset != entry.offset ||
+          index[pos].timestamp != entry.timestamp) {
+        xSemaphoreGive(recorder_mutex);
+        aborted = true;
+        break;
+      }
+      data_file.seek(offset);
+      size_t n = data_file.read(chunk, to_read);
+      // Restore the writer's position before letting it back in
+      data_file.seek(write_offset);
+      xSemaphoreGive(recorder_mutex);
+
+      if (n == 0) {
+        aborted = true;
+        break;
+      }
+      if (!sink(ctx, entry, chunk, n, first)) {
+        return delivered; // Client went away
+      }
+      first = false;
+      offset += n;
+      remaining -= n;
+      esp_task_wdt_reset();
+    }
+
+    if (!aborted) {
+      delivered++;
+    }
+  }
+
+  return delivered;
+}
+
+int RecorderManager::getIndexSummary(uint32_t *oldest_ts,
+                                     uint32_t *newest_ts) {
+  xSemaphoreTake(recorder_mutex, portMAX_DELAY);
+  int count = index_count;
+  if (count > 0) {
+    int oldest_pos = index_count < RECORDER_INDEX_ENTRIES
+                         ? 0
+                         : index_head % RECORDER_INDEX_ENTRIES;
+    int newest_pos =
+        (index_head + RECORDER_INDEX_ENTRIES - 1) % RECORDER_INDEX_ENTRIES;
+    if (oldest_ts) {
+      *oldest_ts = index[oldest_pos].timestamp;
+    }
+    if (newest_ts) {
+      *newest_ts = index[newest_pos].timestamp;
+    }
+  }
+  xSemaphoreGive(recorder_mutex);
+  return count;
+}
@@ -0,0 +1,89 @@
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+// DVR-style local recording: a background task spools frames from the
+// continuous-capture ring into a circular file on the SD_MMC card, with an
+// in-RAM index of offsets+timestamps, so WiFi outages lose nothing and
+// history downloads run at SD read speed instead of live-poll speed.
+
+#define RECORDER_MOUNT_POINT "/sdcard"
+#define RECORDER_DIR "/dvr"
+#define RECORDER_DATA_FILE "/dvr/frames.bin"
+#define RECORDER_INDEX_FILE "/dvr/index.bin"
+#define RECORDER_FILE_MAX_BYTES (32UL * 1024UL * 1024UL) // Wrap after 32 MB
+#define RECORDER_INDEX_ENTRIES 512
+#define RECORDER_INTERVAL_MS 200 // ~5 fps spool rate
+#define RECORDER_INDEX_FLUSH_FRAMES 64
+#define RECORDER_TASK_CORE 1
+#define RECORDER_TASK_STACK_SIZE 4096
+#define RECORDER_TASK_PRIORITY 1
+
+// One recorded frame in the circular data file
+struct FrameIndexEntry {
+  uint32_t offset;
+  uint32_t length;
+  uint32_t timestamp; // millis() at spool time
+};
+
+class RecorderManager {
+public:
+  RecorderManager();
+
+  // Mounts the card (1-bit SD_MMC - 4-bit would claim GPIO4, the flash
+  // LED) and spawns the spooler task. Returns false when no card is
+  // present; the system runs fine without recording.
+  bool begin();
+  void stop();
+  bool isActive() const { return task_handle != nullptr; }
+
+  // Statistics
+  uint32_t getFramesRecorded() const { return frames_recorded; }
+  uint32_t getFramesDropped() const { return frames_dropped; }
+
+  // Range retrieval: invoke callback for every indexed frame with
+  // from <= timestamp <= to (0/UINT32_MAX for open ends). The callback
+  // receives the frame bytes in chunks; return false from it to abort.
+  typedef bool (*FrameSink)(void *ctx, const FrameIndexEntry &entry,
+                            const uint8_t *chunk, size_t chunk_len,
+                            bool first_chunk);
+  int streamRange(uint32_t from, uint32_t to, FrameSink sink, void *ctx);
+
+  // Index summary for /recordings without a range
+  int getIndexSummary(uint32_t *oldest_ts, uint32_t *newest_ts);
+
+  void notifyTaskExit() { task_handle = nullptr; }
+  void spoolLoop(); // Task body, do not call directly
+
+private:
+  bool openDataFile();
+  void spoolFrame(const uint8_t *buf, size_t len, unsigned long timestamp);
+  void flushIndex();
+  void loadIndex();
+
+  TaskHandle_t task_handle;
+  volatile bool running;
+  bool card_mounted;
+
+  File data_file;
+  uint32_t write_offset; // Next write position in the circular file
+
+  // Ring of the newest RECORDER_INDEX_ENTRIES frames
+  FrameIndexEntry index[RECORDER_INDEX_ENTRIES];
+  int index_head; // Next slot to write
+  int index_count;
+  uint32_t frames_since_flush;
+
+  uint32_t frames_recorded;
+  uint32_t frames_dropped;
+  unsigned long last_spooled_timestamp;
+
+  SemaphoreHandle_t recorder_mutex; // Guards file + index
+};
+
+// Global recorder manager instance
+extern RecorderManager recorderManager;
+
+#endif // RECORDER_H
@@ -0,0 +1,477 @@
+// Auto-generated by tools/gen_webpage.py - DO NOT EDIT
+// Source: tools/webpage.html (44523 bytes raw, 7429 bytes gzipped)
+#ifndef WEBPAGE_GZ_H
+#define WEBPAGE_GZ_H
+
+#include <pgmspace.h>
+
+const size_t WEBPAGE_HTML_GZ_LEN = 7429;
+const uint8_t WEBPAGE_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d, 0xdb, 0x72, 0xe3, 0xc6,
+    0x72, 0xef, 0xfb, 0x15, 0x63, 0xda, 0x3e, 0x24, 0x7d, 0x48, 0x0a, 0x24, 0x25, 0xad, 0x4c, 0x5d,
+    0x72, 0x76, 0xb5, 0x37, 0x9d, 0xac, 0x57, 0xf2, 0x52, 0x6b, 0x9f, 0x53, 0xa9, 0xd4, 0x2e, 0x48,
+    0x0c, 0x49, 0x58, 0x20, 0x00, 0x03, 0xa0, 0x28, 0x79, 0x8f, 0xbe, 0x21, 0x0f, 0xa9, 0xca, 0x43,
+    0x5e, 0x52, 0xf9, 0x8b, 0x7c, 0x4f, 0x7e, 0x20, 0xf9, 0x84, 0xf4, 0x5c, 0x00, 0xe2, 0x32, 0x17,
+    0x00, 0xa4, 0x77, 0xb7, 0x92, 0xa8, 0xec, 0x15, 0x05, 0xce, 0xf4, 0xf4, 0xf4, 0x74, 0xf7, 0xf4,
+    0x6d, 0x06, 0x27, 0x5f, 0x3d, 0xbb, 0x3c, 0xbf, 0xfe, 0xeb, 0xd5, 0x73, 0xb4, 0x88, 0x96, 0xce,
+    0xd9, 0xa3, 0x13, 0xf2, 0x0b, 0x39, 0xa6, 0x3b, 0x3f, 0x6d, 0x60, 0xb7, 0x41, 0x1e, 0x60, 0xd3,
+    0x3a, 0x7b, 0x84, 0xe0, 0xe7, 0x64, 0x89, 0x23, 0x13, 0x4d, 0x17, 0x66, 0x10, 0xe2, 0xe8, 0xb4,
+    0xf1, 0xee, 0xfa, 0x45, 0xf7, 0xa8, 0x91, 0xfe, 0xca, 0x35, 0x97, 0xf8, 0xb4, 0x71, 0x6b, 0xe3,
+    0xb5, 0xef, 0x05, 0x51, 0x03, 0x4d, 0x3d, 0x37, 0xc2, 0x2e, 0x34, 0x5d, 0xdb, 0x56, 0xb4, 0x38,
+    0xb5, 0xf0, 0xad, 0x3d, 0xc5, 0x5d, 0xfa, 0x47, 0x07, 0xd9, 0xae, 0x1d, 0xd9, 0xa6, 0xd3, 0x0d,
+    0xa7, 0xa6, 0x83, 0x4f, 0xfb, 0x3d, 0x23, 0x06, 0x15, 0xd9, 0x91, 0x83, 0xcf, 0x9e, 0x8f, 0xaf,
+    0x86, 0x83, 0xee, 0xf9, 0x93, 0x1f, 0xd0, 0x6b, 0xfb, 0x16, 0xa3, 0x71, 0x14, 0x60, 0x73, 0x79,
+    0xb2, 0xc7, 0xbe, 0x64, 0x0d, 0xc3, 0xe8, 0x3e, 0xfe, 0x4c, 0x7e, 0xbe, 0x43, 0x1f, 0x93, 0xcf,
+    0xe4, 0x67, 0x69, 0x06, 0x73, 0xdb, 0x1d, 0x21, 0xe3, 0x38, 0xf3, 0xd8, 0x37, 0x2d, 0xcb, 0x76,
+    0xe7, 0x85, 0xe7, 0x13, 0xef, 0xae, 0x1b, 0xda, 0xbf, 0xd1, 0xaf, 0x26, 0x5e, 0x60, 0xe1, 0xa0,
+    0x0b, 0x8f, 0x36, 0x6d, 0x1e, 0x1e, 0x3d, 0xda, 0x34, 0xb5, 0xee, 0x73, 0x83, 0xcd, 0x60, 0xaa,
+    0xdd, 0x99, 0xb9, 0xb4, 0x9d, 0xfb, 0x11, 0x6a, 0x8e, 0xf1, 0xdc, 0xc3, 0xe8, 0xdd, 0x45, 0xb3,
+    0x83, 0xae, 0xcd, 0x85, 0xb7, 0x34, 0x3b, 0xe8, 0x25, 0x76, 0xf1, 0x2d, 0xfc, 0xfe, 0x09, 0x07,
+    0x96, 0xe9, 0xc2, 0x87, 0xd0, 0x74, 0xc3, 0x6e, 0x88, 0x03, 0x7b, 0x96, 0xc3, 0xc3, 0x9c, 0xde,
+    0xcc, 0x03, 0x6f, 0xe5, 0x5a, 0x23, 0xe4, 0xd8, 0x2e, 0x36, 0x83, 0xee, 0x3c, 0x30, 0x2d, 0x1b,
+    0x08, 0xd9, 0xea, 0x0f, 0x0f, 0x2c, 0x3c, 0xef, 0xa0, 0xaf, 0xfb, 0x78, 0x38, 0x7d, 0x3c, 0x40,
+    0xc6, 0xb7, 0xf0, 0x79, 0x60, 0x1e, 0x0c, 0xbe, 0x3f, 0x42, 0x7d, 0xc3, 0xf8, 0xb6, 0x9d, 0x05,
+    0x35, 0xf5, 0x1c, 0x2f, 0x18, 0xa1, 0xaf, 0x67, 0xb3, 0xdc, 0x18, 0x4b, 0xdb, 0xed, 0x2e, 0xb0,
+    0x3d, 0x5f, 0x44, 0x23, 0xd2, 0xef, 0x76, 0x21, 0x9c, 0x66, 0x8f, 0xac, 0x9f, 0x09, 0x28, 0x04,
+    0x05, 0xca, 0xde, 0xb1, 0x55, 0x84, 0xde, 0xfb, 0x86, 0xe1, 0xdf, 0x1d, 0x8b, 0x09, 0x8f, 0xcc,
+    0x55, 0xe4, 0x49, 0xa8, 0x3f, 0x28, 0x74, 0xb3, 0xec, 0xd0, 0x77, 0x4c, 0x20, 0xdf, 0x3c, 0xb0,
+    0xad, 0xec, 0x57, 0xe4, 0x49, 0x37, 0xc2, 0x4b, 0xf8, 0x3e, 0xc2, 0x5d, 0x98, 0xd6, 0x6a, 0xe9,
+    0x86, 0x00, 0x63, 0x16, 0xa0, 0xfe, 0x2c, 0xc8, 0xb5, 0x35, 0x7d, 0x11, 0xf4, 0x92, 0x53, 0x76,
+    0xf0, 0x2c, 0xe2, 0x03, 0xe4, 0x26, 0x9d, 0xa0, 0x37, 0x73, 0x70, 0x0e, 0x36, 0x79, 0xd2, 0xb5,
+    0xec, 0x00, 0x4f, 0x23, 0xdb, 0x83, 0x89, 0xb3, 0xfe, 0x5a, 0xb4, 0xd2, 0xe3, 0xde, 0xda, 0x16,
+    0xf6, 0x80, 0x1d, 0x28, 0x84, 0xdc, 0xc8, 0x69, 0x8e, 0x08, 0xe6, 0x13, 0xb3, 0x35, 0x38, 0x38,
+    0xe8, 0xa0, 0xcd, 0x3f, 0x46, 0xaf, 0xdf, 0xce, 0xf3, 0x32, 0xe5, 0x5f, 0xc2, 0x36, 0x2b, 0xa0,
+    0x53, 0xff, 0x20, 0x4f, 0x0d, 0xc5, 0x32, 0x90, 0xd1, 0xac, 0xc0, 0xf3, 0xbb, 0x33, 0xdb, 0x89,
+    0x30, 0xb0, 0xcf, 0xc4, 0x59, 0x05, 0xad, 0x3e, 0xb4, 0x13, 0x0e, 0x02, 0xd0, 0xfd, 0x3b, 0x14,
+    0x7a, 0x8e, 0x6d, 0x49, 0x90, 0x1b, 0xb4, 0xe5, 0xdc, 0x15, 0x78, 0x4e, 0x28, 0x99, 0xf5, 0xef,
+    0x4b, 0x6f, 0x3e, 0x78, 0xd7, 0x37, 0x5d, 0xec, 0x74, 0x50, 0xcf, 0x37, 0xef, 0x1d, 0xcf, 0xb4,
+    0xd8, 0xdf, 0xff, 0x27, 0xe8, 0xbf, 0xe8, 0x77, 0xd0, 0x62, 0x90, 0x9b, 0x6a, 0x84, 0xef, 0xa2,
+    0xae, 0xe9, 0xd8, 0x73, 0x42, 0x55, 0xd0, 0x38, 0x38, 0x10, 0x89, 0x36, 0x28, 0xc6, 0x28, 0xf2,
+    0x96, 0x22, 0xec, 0x85, 0x2a, 0x27, 0x35, 0xea, 0xd7, 0x21, 0x55, 0xe4, 0x5d, 0x99, 0x6a, 0xf1,
+    0xbd, 0xd0, 0x66, 0x8b, 0x1a, 0x60, 0x10, 0x76, 0x50, 0xfd, 0x59, 0xf8, 0xb1, 0xda, 0x01, 0x65,
+    0x77, 0x2c, 0xd5, 0x49, 0x85, 0x2f, 0xf3, 0xeb, 0x51, 0x40, 0xdb, 0xbb, 0xc5, 0xc1, 0xcc, 0xf1,
+    0xd6, 0x23, 0xb4, 0xb0, 0x2d, 0x0b, 0xbb, 0x82, 0xad, 0x61, 0x61, 0x5a, 0xe4, 0x7b, 0x03, 0x1d,
+    0x01, 0xbd, 0x87, 0x03, 0xf8, 0x87, 0x92, 0xdb, 0x00, 0x12, 0xb3, 0xff, 0x7a, 0x43, 0x31, 0xa1,
+    0xbf, 0x9e, 0xc2, 0xb6, 0x18, 0x98, 0x5d, 0xce, 0xd0, 0xb9, 0x09, 0x4b, 0x71, 0x8e, 0x95, 0x55,
+    0x51, 0x87, 0x26, 0x92, 0x31, 0x71, 0xbc, 0xe9, 0x4d, 0x91, 0x0c, 0x71, 0xcf, 0xc7, 0x19, 0x2d,
+    0x47, 0xa7, 0x39, 0xf9, 0x05, 0x64, 0x06, 0x38, 0x2b, 0x1a, 0x21, 0xbe, 0x02, 0xc7, 0x3b, 0x61,
+    0x75, 0x60, 0x05, 0x20, 0x88, 0x65, 0x86, 0x0b, 0x2c, 0x63, 0xc3, 0x61, 0x5b, 0xae, 0x90, 0x87,
+    0x46, 0x4e, 0x50, 0xe3, 0x4f, 0x05, 0x22, 0xc2, 0xc4, 0xa7, 0x78, 0xe1, 0x39, 0x56, 0x81, 0x73,
+    0x14, 0xfa, 0xe2, 0x97, 0x55, 0x18, 0xd9, 0xb3, 0xfb, 0x2e, 0xb7, 0x47, 0xc4, 0xac, 0x4d, 0xb9,
+    0xbe, 0x6b, 0xc3, 0x2e, 0x13, 0x8a, 0x1b, 0x48, 0x90, 0x4d, 0x71, 0xbd, 0x78, 0xe2, 0x87, 0xb9,
+    0x89, 0x53, 0x53, 0x01, 0x2c, 0x0d, 0x0c, 0xab, 0x7e, 0x94, 0x87, 0xa4, 0x12, 0xc0, 0xb4, 0xfe,
+    0xf2, 0x17, 0x5e, 0xe4, 0x75, 0x09, 0xdb, 0x16, 0x59, 0x6a, 0x23, 0x43, 0xe6, 0x04, 0x14, 0xc3,
+    0x2a, 0xca, 0xc9, 0x50, 0xe4, 0xf9, 0x22, 0x19, 0x08, 0xe2, 0xcd, 0x51, 0xa4, 0x91, 0x32, 0x4c,
+    0x91, 0xe2, 0xf9, 0xc7, 0x65, 0x4d, 0x8e, 0x44, 0xe3, 0x11, 0xf1, 0xe9, 0x0f, 0x0a, 0x63, 0x64,
+    0x25, 0xb4, 0xa0, 0x30, 0xd3, 0x44, 0x1b, 0x08, 0xbf, 0x8c, 0x8d, 0xaf, 0xa5, 0xe7, 0x7a, 0xa1,
+    0x0f, 0x5c, 0xa2, 0x56, 0xfc, 0x64, 0x42, 0xbe, 0xd0, 0x62, 0x94, 0x68, 0x37, 0x39, 0x10, 0xc7,
+    0x9c, 0x14, 0xf6, 0x0c, 0xb5, 0x8c, 0x66, 0x86, 0x39, 0x12, 0x4e, 0x67, 0xcd, 0xb9, 0xed, 0xd0,
+    0x30, 0xaa, 0x69, 0xd8, 0x5e, 0x08, 0x5b, 0x01, 0x90, 0xb2, 0xae, 0x86, 0xcd, 0x61, 0x97, 0xdd,
+    0xbb, 0x8a, 0xe3, 0x54, 0x55, 0x67, 0x87, 0x9a, 0x95, 0x1f, 0x6a, 0xb9, 0x4f, 0xab, 0x59, 0xbc,
+    0x55, 0x44, 0x0c, 0xe7, 0x11, 0x72, 0x3d, 0x37, 0x37, 0x39, 0x20, 0xeb, 0xe4, 0xc6, 0x06, 0x09,
+    0xf3, 0x7d, 0x30, 0xac, 0x4d, 0x77, 0x2a, 0x6c, 0x25, 0xff, 0xb6, 0x38, 0xff, 0xd1, 0x28, 0x86,
+    0xc9, 0xe9, 0x1e, 0x2d, 0x56, 0xcb, 0x49, 0x8e, 0x2a, 0xea, 0xe1, 0x38, 0xcd, 0x8a, 0x9b, 0x69,
+    0x4c, 0x33, 0x81, 0x91, 0x90, 0x13, 0x97, 0xc2, 0x86, 0x97, 0x22, 0xda, 0xd7, 0xfb, 0xe7, 0x4f,
+    0x5e, 0x1c, 0xe4, 0xb9, 0x68, 0x15, 0x84, 0x84, 0x8d, 0x7c, 0xcf, 0x2e, 0x6a, 0xba, 0xec, 0x7e,
+    0x47, 0x34, 0xfb, 0x61, 0xf9, 0xed, 0x6e, 0x43, 0x97, 0xa5, 0xf7, 0x1b, 0x60, 0xe8, 0xce, 0xb1,
+    0x90, 0x26, 0x5f, 0xe0, 0xac, 0xd9, 0x4e, 0x56, 0x5c, 0xa0, 0x5d, 0xd0, 0xa3, 0x7b, 0x6b, 0x3a,
+    0x2b, 0x5c, 0x51, 0x53, 0x73, 0x95, 0x6c, 0x08, 0xf4, 0x77, 0x77, 0x70, 0xa0, 0x92, 0x14, 0xf1,
+    0xf4, 0x99, 0xea, 0x58, 0x2f, 0xec, 0xfc, 0x40, 0x1b, 0x7b, 0x14, 0x26, 0x76, 0xa4, 0xa1, 0xbb,
+    0x44, 0x01, 0x2b, 0xb5, 0x73, 0xac, 0xce, 0x26, 0xb0, 0x75, 0x8b, 0xc9, 0x34, 0x77, 0xcc, 0x30,
+    0xec, 0xda, 0xae, 0xbf, 0x8a, 0xca, 0xea, 0x94, 0x04, 0xeb, 0xe2, 0xa0, 0x79, 0x2d, 0x26, 0xe1,
+    0xa5, 0x6a, 0xd6, 0xb3, 0x80, 0x16, 0x47, 0xd5, 0xd5, 0x55, 0xbf, 0xec, 0x96, 0x99, 0xa6, 0xea,
+    0x7e, 0xc1, 0x62, 0x95, 0x2b, 0xb9, 0x08, 0x84, 0x2e, 0xe1, 0x2b, 0xc7, 0x21, 0xac, 0x19, 0x22,
+    0x6c, 0x86, 0x58, 0x4b, 0xf8, 0xd1, 0xcc, 0x9b, 0xae, 0xc2, 0xca, 0xee, 0x8f, 0x84, 0x46, 0x4a,
+    0xab, 0x68, 0x5f, 0x2c, 0x2d, 0x21, 0x76, 0xc0, 0x42, 0xed, 0xa0, 0xc9, 0x0a, 0x16, 0xce, 0xfd,
+    0x94, 0x8c, 0x20, 0x12, 0xfb, 0x6d, 0x97, 0x7a, 0xb0, 0x93, 0xa5, 0x56, 0x6a, 0xad, 0x6a, 0x8b,
+    0xcd, 0xc8, 0x8b, 0x3c, 0x5f, 0x13, 0x66, 0xe0, 0x01, 0xa6, 0x6a, 0x96, 0x87, 0x70, 0xcd, 0x54,
+    0xe1, 0xac, 0x7d, 0x1e, 0xcd, 0x62, 0xba, 0x8a, 0x7c, 0x38, 0x30, 0x8d, 0xfd, 0xef, 0xdb, 0x55,
+    0xcc, 0x21, 0x6a, 0x30, 0x53, 0x22, 0xcc, 0xbc, 0x00, 0x16, 0x78, 0x05, 0x5b, 0x6d, 0x30, 0xcd,
+    0xcc, 0x9f, 0xfc, 0x38, 0x38, 0x02, 0xd2, 0x75, 0x89, 0x61, 0xc8, 0x82, 0x7f, 0x3d, 0x99, 0x5d,
+    0xc3, 0x66, 0x31, 0x5a, 0x10, 0xdb, 0x3a, 0xef, 0x1d, 0x6f, 0x86, 0xa1, 0x1f, 0x49, 0x34, 0xea,
+    0xaf, 0xad, 0xee, 0x40, 0xe0, 0x9a, 0xa7, 0x37, 0x8c, 0x7d, 0x6e, 0xf1, 0x32, 0x26, 0x79, 0x7c,
+    0xd8, 0x41, 0xfd, 0xc7, 0xc0, 0x1e, 0x47, 0xaa, 0x5d, 0x83, 0x63, 0x61, 0x4e, 0x89, 0x81, 0x56,
+    0x0a, 0x0d, 0x43, 0xb2, 0xfd, 0xcc, 0x40, 0xbc, 0x17, 0xdd, 0x38, 0xd8, 0x22, 0x33, 0x53, 0x4b,
+    0xc7, 0xdc, 0xfa, 0xd2, 0x98, 0x5b, 0x5f, 0x6a, 0x2e, 0xe7, 0x50, 0x10, 0xf2, 0x89, 0x20, 0x5a,
+    0x9b, 0xf1, 0x77, 0x78, 0x7c, 0x46, 0xec, 0x44, 0x67, 0x59, 0xd7, 0xec, 0x9b, 0x83, 0x8a, 0xa2,
+    0xbc, 0x51, 0x20, 0x07, 0x4a, 0xe7, 0xa2, 0x79, 0xee, 0xad, 0x02, 0x1b, 0x18, 0xe3, 0x0d, 0x5e,
+    0x37, 0x3b, 0x22, 0x5f, 0x43, 0xbb, 0x1d, 0x12, 0x21, 0xd8, 0x44, 0x22, 0x7b, 0xfb, 0x72, 0xff,
+    0x5d, 0xe0, 0x68, 0xc6, 0x71, 0x8a, 0xee, 0xbd, 0x28, 0x30, 0x50, 0x76, 0x4f, 0xeb, 0xb7, 0xcb,
+    0x11, 0xd9, 0x0f, 0x70, 0xb9, 0x98, 0x3a, 0xb5, 0x28, 0xa8, 0x70, 0xc1, 0x94, 0xa1, 0x57, 0x77,
+    0x1d, 0x98, 0x7e, 0xae, 0x09, 0xe0, 0x46, 0x1f, 0x83, 0x0d, 0x10, 0x60, 0xf3, 0xa6, 0x4b, 0x1e,
+    0x48, 0x0c, 0xa6, 0xc8, 0x8c, 0x56, 0x64, 0x47, 0xb2, 0xec, 0xa9, 0x19, 0x79, 0x52, 0x47, 0xdf,
+    0x76, 0x29, 0x2d, 0x05, 0x1e, 0x56, 0xb2, 0x51, 0xc8, 0x6c, 0xcb, 0x7e, 0x65, 0xdb, 0x92, 0xef,
+    0x23, 0xdc, 0x22, 0x3b, 0x92, 0x3a, 0x45, 0x0c, 0x77, 0xe0, 0x75, 0x17, 0x14, 0x2d, 0xb6, 0x54,
+    0x8c, 0x2a, 0x32, 0xd1, 0xb2, 0x9a, 0xc3, 0xa0, 0x88, 0x16, 0x5b, 0x0a, 0x46, 0x04, 0xaa, 0x94,
+    0x1a, 0x74, 0xb6, 0xbf, 0x3f, 0x1c, 0x1e, 0x96, 0x19, 0x34, 0xdf, 0x32, 0x3d, 0x68, 0x64, 0x2f,
+    0x31, 0x0c, 0xbc, 0xcc, 0x7b, 0xd0, 0xf1, 0x16, 0x71, 0x74, 0x74, 0x24, 0x17, 0x09, 0xa3, 0xd2,
+    0x1e, 0x9d, 0x1a, 0xf6, 0x4f, 0x4b, 0x6c, 0xd9, 0x26, 0x6a, 0x65, 0x62, 0x7d, 0x03, 0x50, 0xaf,
+    0xed, 0x1c, 0x1a, 0xd2, 0xcc, 0x85, 0x5a, 0xb1, 0x1d, 0x17, 0xdb, 0x52, 0xc5, 0x56, 0xd0, 0x09,
+    0x0f, 0x99, 0xbf, 0xb2, 0x43, 0xcb, 0x33, 0x08, 0x54, 0x80, 0xb9, 0x84, 0x96, 0x87, 0xa7, 0x09,
+    0x93, 0xa7, 0x80, 0x0e, 0x64, 0x40, 0x33, 0x09, 0x0e, 0x10, 0x70, 0xd0, 0x74, 0x5f, 0x50, 0xf0,
+    0x4c, 0x19, 0x0f, 0x8b, 0x19, 0x6a, 0x3a, 0x9d, 0x8a, 0x39, 0x71, 0x6d, 0xcf, 0x6c, 0x50, 0x15,
+    0x33, 0xaf, 0x4b, 0xd6, 0x75, 0xeb, 0xed, 0x2d, 0xc0, 0xe0, 0xa9, 0x47, 0x2d, 0xa2, 0x5b, 0x49,
+    0x98, 0xb4, 0x43, 0xc2, 0x94, 0xc0, 0x6e, 0xa0, 0x43, 0x01, 0xef, 0x0e, 0x61, 0x92, 0x76, 0x5b,
+    0xb4, 0xf7, 0x1d, 0x68, 0x78, 0x5a, 0x1e, 0x4b, 0xa2, 0xb8, 0x13, 0xca, 0x55, 0x36, 0xbb, 0x8d,
+    0x83, 0x76, 0x69, 0x33, 0x58, 0x6b, 0xcb, 0x6e, 0xb9, 0x75, 0x6c, 0x66, 0x51, 0x35, 0x1a, 0xa6,
+    0xdc, 0x2c, 0x95, 0x2e, 0x44, 0x3e, 0xf6, 0x98, 0x23, 0xf9, 0x81, 0x30, 0xb6, 0xba, 0x4b, 0x53,
+    0x91, 0xcd, 0x5a, 0xe4, 0xd8, 0x2b, 0xed, 0xf9, 0x1a, 0xf1, 0xbd, 0x1a, 0x86, 0x48, 0x41, 0x48,
+    0xd8, 0x46, 0x51, 0x5e, 0xf0, 0xb5, 0x32, 0x5d, 0x4a, 0x33, 0x28, 0x2c, 0xab, 0x1a, 0x1c, 0xfe,
+    0x7b, 0xb3, 0xf1, 0x74, 0x81, 0xa7, 0x37, 0x64, 0x3b, 0x14, 0x85, 0x87, 0x77, 0x91, 0x91, 0x94,
+    0x1b, 0xc9, 0xc9, 0xd0, 0x4a, 0x01, 0xaa, 0xb1, 0x4c, 0x4a, 0xf7, 0xb1, 0x3c, 0xa3, 0xba, 0x20,
+    0x33, 0xa6, 0x83, 0xbe, 0xb2, 0x97, 0xa4, 0xb8, 0xc3, 0x74, 0x23, 0xa5, 0xf0, 0x19, 0xc2, 0x86,
+    0xa9, 0xf9, 0xee, 0x7d, 0x87, 0xae, 0xbd, 0xf9, 0xdc, 0xc1, 0x88, 0x6f, 0x70, 0x88, 0x96, 0x73,
+    0x84, 0xe8, 0xbb, 0xbd, 0x94, 0x99, 0x41, 0x5b, 0xc4, 0x9e, 0xc3, 0xef, 0xc9, 0xba, 0x54, 0x78,
+    0xba, 0x13, 0x1c, 0xad, 0x71, 0x3e, 0xfb, 0x57, 0x3a, 0x20, 0x9e, 0xc3, 0x56, 0xb4, 0x8e, 0xa5,
+    0xa8, 0x54, 0x20, 0xfd, 0x41, 0xe5, 0x1c, 0x00, 0x47, 0x25, 0x5c, 0xdb, 0xd1, 0x74, 0x51, 0x2f,
+    0xc5, 0x7a, 0x28, 0x35, 0x9e, 0x87, 0xc6, 0xf6, 0x31, 0x7a, 0x6d, 0x86, 0x7c, 0xdb, 0xa0, 0x87,
+    0x3a, 0xb4, 0x23, 0x89, 0x9e, 0x49, 0x49, 0xd8, 0xd3, 0x17, 0x65, 0xe4, 0xfc, 0xfa, 0xa3, 0x76,
+    0x09, 0xb0, 0xa3, 0xd1, 0x04, 0xc3, 0x5e, 0x84, 0x0b, 0x56, 0x34, 0xe7, 0xca, 0x66, 0xf3, 0xb8,
+    0x7a, 0x66, 0xaf, 0x90, 0x41, 0x21, 0x16, 0xa9, 0xe0, 0x71, 0x1c, 0x80, 0xdf, 0x97, 0x06, 0xe0,
+    0xf7, 0x95, 0x11, 0xe6, 0xc2, 0x06, 0xa5, 0x73, 0xa1, 0x4a, 0xaf, 0xda, 0x36, 0xd1, 0xf6, 0xfc,
+    0xb2, 0x49, 0x48, 0x2c, 0x8a, 0xa1, 0xfc, 0xa5, 0x35, 0xcc, 0x56, 0x59, 0xc8, 0xd7, 0x4d, 0x13,
+    0x1d, 0xa2, 0x35, 0x6d, 0xad, 0x7e, 0x76, 0xff, 0x92, 0x43, 0xd3, 0x45, 0x79, 0x18, 0x38, 0xa3,
+    0xf7, 0xbd, 0x04, 0x1c, 0xe8, 0xd2, 0xb1, 0x6f, 0xbb, 0xc4, 0xdd, 0x11, 0x28, 0xd1, 0x90, 0x7d,
+    0xb5, 0x4d, 0xb2, 0xd8, 0x10, 0x31, 0x94, 0x51, 0x26, 0x57, 0x91, 0x68, 0xba, 0xf2, 0x29, 0xe5,
+    0xa3, 0xb6, 0xa4, 0xdc, 0xa1, 0x28, 0xc6, 0xbb, 0xf1, 0x4d, 0xb4, 0xd5, 0x21, 0xbf, 0x91, 0x58,
+    0x04, 0xbe, 0x23, 0x5f, 0x49, 0x7c, 0x70, 0x4e, 0x62, 0x99, 0xdb, 0xb9, 0xa5, 0xe5, 0xb0, 0xbd,
+    0x25, 0x26, 0x40, 0x56, 0x1c, 0x5b, 0x97, 0x6b, 0xfd, 0x43, 0x69, 0xe4, 0x7c, 0x5f, 0x63, 0x6c,
+    0x49, 0x74, 0x3f, 0xe5, 0xac, 0x4d, 0x5f, 0x49, 0x38, 0x44, 0xad, 0x52, 0x4c, 0xd7, 0x5e, 0x9a,
+    0x8c, 0x70, 0x64, 0x5a, 0xa8, 0x1f, 0xf2, 0x20, 0x33, 0x02, 0xd3, 0x9c, 0x54, 0x98, 0xd6, 0x4e,
+    0x6e, 0xf3, 0x15, 0x25, 0x3e, 0x83, 0x24, 0xc6, 0xa1, 0x0c, 0xe2, 0x1f, 0x56, 0x33, 0xfa, 0x4b,
+    0x96, 0x7d, 0xfc, 0xe9, 0x06, 0xdf, 0xcf, 0x02, 0x73, 0x09, 0x12, 0x4e, 0xa7, 0x9b, 0x45, 0xcc,
+    0xf8, 0x16, 0x7d, 0x4c, 0xab, 0x8d, 0xc0, 0x03, 0x8b, 0x1f, 0xf4, 0x86, 0x85, 0xe7, 0xed, 0xe3,
+    0x5c, 0x8c, 0x81, 0xe4, 0x50, 0x84, 0xad, 0x87, 0x87, 0x85, 0xf6, 0xea, 0x08, 0xcc, 0xe3, 0xc3,
+    0x23, 0x41, 0x00, 0x46, 0xe9, 0x96, 0x57, 0x89, 0xc2, 0x14, 0xd0, 0x38, 0xd9, 0xe3, 0x75, 0xbf,
+    0x27, 0x7b, 0xac, 0x34, 0xf9, 0x84, 0x94, 0xe3, 0xf2, 0x92, 0x60, 0xcb, 0xbe, 0x45, 0x53, 0x92,
+    0xcf, 0x3a, 0x6d, 0x24, 0xb2, 0xd8, 0xd8, 0x94, 0x08, 0xa7, 0xbf, 0x4f, 0xc5, 0x69, 0x52, 0x2d,
+    0xf2, 0xad, 0x32, 0x75, 0x99, 0xb9, 0x76, 0xb4, 0xed, 0xa2, 0x9f, 0x2a, 0x55, 0xbe, 0x22, 0x55,
+    0x39, 0xe8, 0xdc, 0xf4, 0xa3, 0x55, 0x80, 0x01, 0xbf, 0xbe, 0xa0, 0x03, 0x01, 0x6e, 0x5b, 0xa7,
+    0x8d, 0x7c, 0x21, 0x9c, 0x00, 0x78, 0xa6, 0x7d, 0xb1, 0x00, 0x4a, 0xd2, 0x23, 0xee, 0x25, 0xff,
+    0x96, 0xb6, 0xf0, 0xcf, 0xce, 0x1d, 0x7b, 0x7a, 0x83, 0x1a, 0xd7, 0xe6, 0x0d, 0x66, 0x98, 0x37,
+    0x40, 0xdb, 0xa3, 0x29, 0xc3, 0x1e, 0x44, 0x0b, 0x81, 0x6c, 0xcd, 0x61, 0x1a, 0xbe, 0x0e, 0x12,
+    0xdb, 0x75, 0x4e, 0x1b, 0x79, 0x67, 0x22, 0x16, 0xb7, 0x4d, 0xc1, 0x11, 0xd2, 0xe5, 0x04, 0x1b,
+    0x67, 0x4f, 0x2c, 0xa2, 0xcd, 0x50, 0x08, 0x5e, 0x38, 0xf8, 0x8d, 0x21, 0x02, 0x23, 0xda, 0x5b,
+    0x03, 0x36, 0x16, 0x2c, 0x09, 0xc1, 0x77, 0x1a, 0x53, 0x57, 0x81, 0xd6, 0xc9, 0x9e, 0x74, 0xfe,
+    0xaa, 0xaf, 0xec, 0xe5, 0x3c, 0x4d, 0x6a, 0xae, 0xb5, 0x1b, 0x28, 0x0c, 0xa6, 0xa7, 0x8d, 0x06,
+    0xa8, 0xe1, 0xe8, 0xb4, 0x91, 0x5b, 0xec, 0x46, 0x3c, 0xf7, 0xec, 0x2e, 0xa5, 0x5a, 0x4c, 0xce,
+    0x59, 0x99, 0x0a, 0xae, 0x6a, 0x60, 0x58, 0xf5, 0xbb, 0x0f, 0x2b, 0xc4, 0x61, 0xe5, 0x23, 0xe6,
+    0x0d, 0x36, 0x0d, 0x16, 0x0f, 0x06, 0xc6, 0xe5, 0xbe, 0x7f, 0xe3, 0x0c, 0x84, 0x07, 0xba, 0xe9,
+    0xa0, 0x92, 0xce, 0x0c, 0xbd, 0xb8, 0xdf, 0x5b, 0x90, 0xb4, 0x7b, 0x55, 0x67, 0x15, 0x59, 0x53,
+    0x93, 0xce, 0xd9, 0x22, 0x0c, 0xcf, 0xfc, 0x43, 0x35, 0x5b, 0xe7, 0x41, 0xe9, 0x04, 0x48, 0xd1,
+    0x97, 0xd0, 0x43, 0x2f, 0x28, 0x82, 0x31, 0x89, 0xba, 0x6e, 0x9c, 0x31, 0x39, 0x27, 0xc1, 0x54,
+    0xca, 0x0a, 0xbd, 0x5e, 0x4f, 0x03, 0xae, 0x3a, 0x5b, 0x0a, 0x1e, 0xf3, 0x47, 0x5b, 0x68, 0xac,
+    0xc1, 0xd9, 0xcf, 0xf6, 0x0b, 0x1b, 0x8d, 0xb9, 0x84, 0x81, 0x9e, 0x1a, 0x48, 0xf4, 0x14, 0x07,
+    0x99, 0x55, 0xe6, 0x25, 0x78, 0x3b, 0x89, 0x06, 0xaa, 0xd6, 0x92, 0xfa, 0xc7, 0x67, 0x6f, 0xc0,
+    0xe5, 0xf6, 0x82, 0x1b, 0xf4, 0x06, 0x64, 0x0e, 0xb5, 0xc6, 0xe3, 0x8b, 0x67, 0xed, 0xd1, 0xc9,
+    0x1e, 0xfb, 0xae, 0x14, 0x1f, 0x6c, 0x62, 0x70, 0x8c, 0x9b, 0x58, 0xac, 0x2b, 0x24, 0x78, 0xbe,
+    0x66, 0xb1, 0x6e, 0xf5, 0xc2, 0x94, 0xe4, 0xdc, 0x0a, 0x53, 0xba, 0xb8, 0x42, 0x4f, 0x2c, 0x2b,
+    0xc0, 0x61, 0xb8, 0x83, 0x99, 0xd8, 0xfe, 0x67, 0x9b, 0xc7, 0x79, 0xa2, 0x3f, 0xd0, 0x0f, 0x9e,
+    0x85, 0x77, 0x30, 0x99, 0x25, 0x80, 0xf9, 0x6c, 0xd3, 0x19, 0x83, 0x75, 0x65, 0x3a, 0xf4, 0x24,
+    0x91, 0x3b, 0x07, 0xcb, 0x65, 0x07, 0x5c, 0x46, 0x21, 0x7e, 0xb6, 0x09, 0x5d, 0xff, 0x05, 0x5d,
+    0x79, 0x6b, 0xb0, 0xc0, 0xb7, 0x9f, 0x49, 0x74, 0xe7, 0x13, 0x48, 0x9f, 0x6d, 0x2a, 0x2f, 0xc1,
+    0x08, 0x5c, 0xc3, 0xb6, 0xb7, 0xfd, 0x4c, 0xe6, 0x0c, 0xd2, 0x67, 0x9b, 0xc9, 0x0f, 0x4f, 0xce,
+    0x77, 0x28, 0xfd, 0x4b, 0x73, 0xfa, 0xd9, 0x66, 0x42, 0x37, 0x89, 0x2b, 0x70, 0x0b, 0x3c, 0x30,
+    0xda, 0x76, 0x30, 0x17, 0x9f, 0x83, 0xfa, 0x12, 0xf4, 0xd9, 0xd8, 0xc7, 0xd8, 0xda, 0x85, 0x06,
+    0x20, 0x70, 0x3e, 0xdf, 0x84, 0x16, 0xa6, 0x4b, 0x8e, 0x2b, 0x3d, 0x05, 0xeb, 0x98, 0x79, 0x63,
+    0xdb, 0xcf, 0x68, 0x12, 0xc3, 0xda, 0x6e, 0x56, 0xb2, 0xc7, 0x79, 0xab, 0x22, 0x36, 0x30, 0x1f,
+    0xd5, 0xb4, 0x71, 0x53, 0x40, 0x52, 0x5f, 0x29, 0xed, 0xdc, 0x8d, 0x8d, 0x9b, 0xee, 0xcc, 0x4d,
+    0x3a, 0x92, 0x84, 0x21, 0x16, 0xdd, 0xc6, 0x76, 0xa6, 0xd3, 0x17, 0x43, 0x13, 0x99, 0x62, 0xcc,
+    0xc4, 0x0a, 0x62, 0x7b, 0x5e, 0x52, 0x0a, 0x19, 0xff, 0x6f, 0xf4, 0xfa, 0x07, 0xed, 0xe3, 0xa4,
+    0xac, 0x86, 0x64, 0x89, 0x91, 0x71, 0x2c, 0xb4, 0xda, 0x86, 0x31, 0xc8, 0xb4, 0x53, 0x45, 0xd3,
+    0xca, 0xc2, 0xa8, 0x86, 0x28, 0xa4, 0xd0, 0x60, 0x32, 0x0d, 0x72, 0x30, 0xb3, 0xe7, 0x60, 0xf6,
+    0x0d, 0xd5, 0x0b, 0x94, 0x39, 0xe5, 0x20, 0x5b, 0x22, 0x96, 0xe5, 0x98, 0x79, 0x41, 0xca, 0xf2,
+    0x62, 0xc5, 0xa4, 0x0d, 0xb0, 0xed, 0xd6, 0x88, 0x58, 0x74, 0x6a, 0xb6, 0x3c, 0x61, 0x35, 0xbf,
+    0xd1, 0xbd, 0x0f, 0x93, 0xa3, 0xcb, 0x90, 0xb5, 0xe3, 0x38, 0xb4, 0x18, 0xab, 0x54, 0xb9, 0x6a,
+    0x83, 0x94, 0x4b, 0x39, 0x74, 0x37, 0x3f, 0x6d, 0x1c, 0x0e, 0x1b, 0x28, 0xe5, 0x1c, 0x9f, 0x36,
+    0x62, 0xcb, 0x92, 0x9c, 0x4a, 0x6e, 0xd4, 0xe2, 0xd0, 0x5a, 0x04, 0xf0, 0xd7, 0xf1, 0xf4, 0xaf,
+    0x00, 0x08, 0xa9, 0x72, 0xd2, 0x4c, 0x9f, 0x0c, 0x98, 0xf3, 0xfe, 0x68, 0x98, 0x90, 0x26, 0x0c,
+    0xa9, 0xd7, 0xac, 0xd2, 0x04, 0x69, 0xe2, 0xf9, 0x7c, 0xc0, 0xb4, 0xd2, 0x5d, 0xab, 0xc8, 0x17,
+    0xfb, 0xed, 0x30, 0xdc, 0xa8, 0x7f, 0xac, 0x26, 0x67, 0x3c, 0x1b, 0x15, 0x32, 0xbc, 0xb2, 0x6f,
+    0x63, 0x56, 0xb0, 0x30, 0xb7, 0xbf, 0x4e, 0x86, 0x62, 0x6a, 0xea, 0x88, 0xb2, 0x6d, 0x9c, 0x1a,
+    0x66, 0x91, 0x81, 0x52, 0xd5, 0xb4, 0xd9, 0x94, 0x4e, 0xb6, 0xa0, 0x5d, 0x94, 0x1c, 0x2e, 0xa4,
+    0x91, 0x1a, 0x67, 0xe3, 0x57, 0x97, 0x3f, 0x9f, 0xec, 0x31, 0x4c, 0x77, 0xad, 0xd2, 0x6a, 0x31,
+    0xcc, 0x64, 0xdd, 0x65, 0x65, 0xb9, 0x8d, 0xb3, 0x92, 0x8a, 0xfc, 0x84, 0x97, 0xf1, 0x6e, 0x94,
+    0x76, 0x02, 0x42, 0xb4, 0xcc, 0x8a, 0x05, 0xe3, 0x85, 0xc0, 0x74, 0x13, 0x38, 0x6d, 0x18, 0x8d,
+    0xb3, 0xff, 0xfe, 0xb7, 0x7f, 0xfe, 0x77, 0xf4, 0x83, 0x79, 0x87, 0xde, 0x92, 0x83, 0x1b, 0xe0,
+    0x90, 0x39, 0x60, 0x17, 0x86, 0x51, 0x1b, 0x75, 0xd1, 0x91, 0x31, 0xe8, 0xf5, 0xfb, 0x93, 0x93,
+    0x3d, 0xd6, 0xa9, 0x34, 0xd4, 0x7e, 0xe3, 0xec, 0x3f, 0xff, 0xf5, 0x5f, 0xfe, 0xeb, 0x3f, 0xfe,
+    0x09, 0xf6, 0x29, 0x87, 0x9c, 0x81, 0xb1, 0xd8, 0xf6, 0x0b, 0x20, 0x5f, 0x5d, 0x0f, 0x8c, 0xca,
+    0xf0, 0x06, 0x04, 0x1e, 0x43, 0x92, 0xc1, 0x69, 0x9d, 0x3b, 0x5e, 0x88, 0x19, 0xc6, 0x6d, 0x0a,
+    0x75, 0x5f, 0x03, 0x15, 0x14, 0x3a, 0x25, 0x57, 0xf9, 0x45, 0xce, 0x73, 0xb6, 0xe9, 0xfb, 0xce,
+    0x7d, 0x77, 0x12, 0xb9, 0x09, 0x67, 0xd7, 0x2a, 0x74, 0x56, 0xf2, 0x73, 0xba, 0xdc, 0x3d, 0x57,
+    0xdb, 0x23, 0xe4, 0xf5, 0x42, 0x88, 0xb9, 0xc0, 0xfd, 0x8a, 0x12, 0x98, 0xc6, 0xd9, 0x93, 0xab,
+    0xab, 0xd7, 0x7f, 0x45, 0x3f, 0x5f, 0xbc, 0xb8, 0x40, 0xe3, 0xe7, 0xd7, 0xd7, 0x17, 0x6f, 0x5e,
+    0x8e, 0xe5, 0x72, 0x92, 0x84, 0x25, 0x29, 0x35, 0xc0, 0xda, 0x5d, 0x39, 0x1b, 0x7d, 0x92, 0x09,
+    0xfb, 0x1d, 0xa4, 0x45, 0x9d, 0x47, 0x01, 0x45, 0xd8, 0x67, 0x23, 0x5f, 0xa2, 0xed, 0x2b, 0x13,
+    0x60, 0x1f, 0x52, 0xbd, 0x28, 0x8f, 0x8f, 0xc8, 0xf6, 0x68, 0x81, 0xb8, 0x86, 0x92, 0x68, 0x89,
+    0x48, 0xb2, 0xe9, 0xf9, 0x70, 0x49, 0x54, 0xe5, 0x9c, 0x86, 0x0d, 0xc9, 0xf6, 0x4a, 0xa1, 0x8a,
+    0xe3, 0x2a, 0x3b, 0xd5, 0x1f, 0x40, 0x77, 0x92, 0xb2, 0xa3, 0x11, 0x3e, 0xae, 0x42, 0xde, 0x26,
+    0x8f, 0xca, 0xeb, 0x10, 0x01, 0x98, 0xb2, 0xc2, 0xf8, 0xee, 0x2f, 0x2f, 0x9f, 0x34, 0xce, 0xc8,
+    0xbf, 0xa8, 0xd5, 0x07, 0x9e, 0xbb, 0xeb, 0x0f, 0x0c, 0xa3, 0x5d, 0x59, 0xa6, 0xc7, 0x14, 0xcc,
+    0x98, 0x81, 0x19, 0x1c, 0x01, 0x18, 0x63, 0xb0, 0x5f, 0x1d, 0x0c, 0x85, 0xc2, 0x80, 0x40, 0xff,
+    0xbb, 0xc7, 0x87, 0x47, 0x35, 0x50, 0xf9, 0x89, 0xa2, 0xf2, 0x13, 0x81, 0x72, 0x04, 0x13, 0x3a,
+    0xac, 0x33, 0x1f, 0x02, 0x83, 0x1f, 0xb6, 0xc0, 0xd6, 0x19, 0x85, 0x75, 0xb8, 0x6f, 0xdc, 0xed,
+    0x1f, 0xd5, 0x80, 0x75, 0x7e, 0xf1, 0x02, 0x0c, 0xd3, 0x8b, 0x17, 0xa8, 0xb5, 0x0f, 0xe8, 0x0c,
+    0xbe, 0x3f, 0xac, 0x0e, 0xe2, 0x47, 0x3a, 0xa7, 0x1f, 0x29, 0x1e, 0xc3, 0x01, 0x00, 0xd9, 0xd7,
+    0xe1, 0xa1, 0xd5, 0x90, 0x3b, 0xe2, 0xe3, 0xb3, 0xa7, 0x34, 0x6f, 0xec, 0x6a, 0xdd, 0xe5, 0x4c,
+    0x18, 0x36, 0x77, 0xc2, 0xb5, 0xac, 0x7d, 0x44, 0x0f, 0x23, 0x32, 0xe3, 0x68, 0x92, 0x0c, 0xcb,
+    0xcf, 0x6d, 0x36, 0xb2, 0xc0, 0x1b, 0xa4, 0xf0, 0xf3, 0xb4, 0xd1, 0x1d, 0x50, 0xa3, 0x88, 0x6c,
+    0x3a, 0x9b, 0x4d, 0x12, 0xd4, 0x1c, 0xf6, 0xe9, 0xbe, 0x56, 0x32, 0x3a, 0x9f, 0x3a, 0x00, 0x58,
+    0x18, 0x9d, 0x3d, 0x3d, 0x33, 0x6a, 0x04, 0xd7, 0x77, 0xbc, 0x12, 0x54, 0x6f, 0x99, 0x61, 0xf4,
+    0x49, 0xd7, 0x61, 0xca, 0x07, 0xad, 0xba, 0x0a, 0x83, 0x1d, 0xac, 0x42, 0x32, 0x36, 0x5f, 0x83,
+    0xc1, 0xe7, 0x5f, 0x83, 0xe7, 0x77, 0xbe, 0x17, 0xae, 0x02, 0xfc, 0x49, 0xd7, 0x00, 0xf3, 0x41,
+    0x95, 0x6b, 0x60, 0xf0, 0x25, 0x20, 0xfa, 0x3d, 0x59, 0x85, 0xa1, 0x91, 0x48, 0xc3, 0x81, 0x51,
+    0x7f, 0x21, 0x12, 0x04, 0xf8, 0x42, 0x00, 0xd8, 0xcf, 0xbf, 0x14, 0x7f, 0xbe, 0x7a, 0xfe, 0x12,
+    0xfd, 0xb8, 0x02, 0x13, 0x24, 0xba, 0xff, 0xa4, 0xcb, 0xf1, 0x2b, 0x1b, 0x53, 0xb9, 0x1a, 0xfd,
+    0x78, 0x39, 0x88, 0x9b, 0x16, 0xdb, 0xd9, 0xbb, 0xd0, 0x4c, 0xf1, 0xe0, 0x7c, 0x25, 0xfa, 0x86,
+    0x3e, 0x63, 0xb8, 0x24, 0xb5, 0x5c, 0xdc, 0xf2, 0x8b, 0x6b, 0x23, 0x4c, 0xd3, 0x3c, 0xce, 0x57,
+    0x7d, 0x67, 0xb2, 0xc1, 0xfb, 0xd4, 0x7c, 0xeb, 0x1b, 0xe8, 0x14, 0x3d, 0x05, 0xff, 0xa2, 0x83,
+    0x0e, 0x87, 0xf0, 0xf1, 0x67, 0x2f, 0x08, 0x23, 0x18, 0x91, 0x80, 0xfc, 0x9c, 0x6b, 0x3f, 0x36,
+    0xa3, 0x55, 0x60, 0x96, 0x30, 0xa2, 0x76, 0xbb, 0xf2, 0x61, 0x32, 0x6c, 0x55, 0x75, 0xd8, 0xdf,
+    0xc1, 0xd2, 0xa7, 0x46, 0x8f, 0x57, 0xff, 0xf3, 0x4b, 0xe1, 0x4b, 0xa0, 0xe5, 0x27, 0x5d, 0x83,
+    0x39, 0x74, 0x2c, 0xa5, 0x08, 0x87, 0xc6, 0x4e, 0xa9, 0x4f, 0xc7, 0xfd, 0x72, 0xe8, 0x0e, 0x9e,
+    0xf5, 0xd4, 0x36, 0x1d, 0xf4, 0x7c, 0x36, 0x03, 0x2b, 0xb0, 0xbc, 0x2b, 0x11, 0xb2, 0x7e, 0x5d,
+    0x4c, 0xfb, 0x55, 0x76, 0x27, 0x60, 0x13, 0x79, 0x03, 0xee, 0x5f, 0x9d, 0x18, 0xc3, 0x1b, 0x3c,
+    0xa7, 0xc5, 0xcc, 0x75, 0xe2, 0x09, 0x2f, 0x03, 0xf3, 0x9e, 0x16, 0x59, 0x56, 0xee, 0x3c, 0x24,
+    0x1e, 0x97, 0x85, 0xae, 0xc1, 0xbf, 0xae, 0xdc, 0x77, 0x9f, 0x0c, 0x8c, 0xb1, 0x5b, 0xaf, 0xf7,
+    0x41, 0xe3, 0xec, 0x29, 0x39, 0x78, 0x52, 0xab, 0xf3, 0x21, 0x78, 0x38, 0xd8, 0xb7, 0xcd, 0x2f,
+    0xc4, 0x09, 0xf8, 0x99, 0x04, 0x3c, 0xe2, 0xf0, 0x50, 0x89, 0x64, 0x73, 0x26, 0x00, 0x36, 0xa1,
+    0x69, 0xe5, 0x3a, 0xac, 0xf6, 0x64, 0x15, 0x79, 0x75, 0x58, 0x6d, 0xbc, 0x72, 0xdd, 0xfb, 0x3a,
+    0x7c, 0x76, 0xee, 0x78, 0x2b, 0xeb, 0xbe, 0x0e, 0x93, 0x5d, 0xce, 0x66, 0xf6, 0x14, 0xd7, 0x61,
+    0xb1, 0x57, 0xde, 0x12, 0x7f, 0x21, 0xcb, 0x7c, 0x41, 0xea, 0xc9, 0xd0, 0x25, 0x45, 0xa5, 0x82,
+    0xbb, 0x97, 0x3d, 0x57, 0xa1, 0x4f, 0x8b, 0xbd, 0xf2, 0x02, 0xfb, 0x37, 0xb2, 0x05, 0x38, 0xe8,
+    0x07, 0x3b, 0x08, 0xbc, 0x40, 0x9f, 0x15, 0xe3, 0xe1, 0xbd, 0xec, 0x80, 0xfc, 0xf4, 0x84, 0x37,
+    0x9b, 0x31, 0x15, 0xbd, 0x58, 0x52, 0x68, 0x3c, 0xaa, 0x4d, 0x82, 0x4f, 0x35, 0xa2, 0xc8, 0xdb,
+    0x4e, 0xee, 0x27, 0x1c, 0x44, 0x36, 0xa8, 0x2a, 0xf4, 0xc2, 0xb1, 0xfd, 0x1d, 0x4d, 0xec, 0x76,
+    0x06, 0xb0, 0xb6, 0x9b, 0xd6, 0x8e, 0x39, 0xe5, 0x05, 0xb9, 0x31, 0x20, 0x8e, 0xa4, 0xfd, 0x7e,
+    0x9c, 0x42, 0x87, 0xd9, 0x11, 0x11, 0xd9, 0x25, 0x07, 0xbf, 0x0f, 0x11, 0x53, 0xd1, 0xe7, 0x00,
+    0x87, 0x38, 0xaa, 0x1c, 0x78, 0x66, 0x67, 0xb9, 0xe1, 0x83, 0x35, 0x1c, 0xcc, 0x06, 0xb3, 0xf6,
+    0xb1, 0xf0, 0xcc, 0x35, 0x8d, 0x1e, 0xe2, 0x88, 0x54, 0x81, 0x3e, 0xc3, 0x33, 0x73, 0xe5, 0x44,
+    0xa1, 0x22, 0x02, 0x9c, 0x42, 0x8a, 0xd7, 0x64, 0x52, 0xb4, 0xce, 0xc6, 0x6f, 0x9e, 0x5c, 0x8d,
+    0x5f, 0x5d, 0x5e, 0x8b, 0xbb, 0xea, 0xca, 0xd7, 0x32, 0x17, 0x71, 0x4a, 0x02, 0xad, 0x4f, 0xae,
+    0x2e, 0xd0, 0x15, 0x6b, 0xa7, 0x2f, 0x5e, 0x4b, 0x8e, 0xaa, 0xb3, 0x65, 0x72, 0x88, 0xc3, 0xbf,
+    0xf2, 0x2d, 0x33, 0xa2, 0x89, 0x7b, 0xf8, 0x0b, 0xf1, 0xbf, 0x46, 0xe8, 0x0d, 0xbe, 0xc5, 0x41,
+    0x89, 0x34, 0x4f, 0xee, 0x9e, 0x04, 0x19, 0x2b, 0x93, 0xeb, 0x13, 0x68, 0x29, 0x25, 0x6f, 0xce,
+    0xab, 0xf3, 0x1b, 0x67, 0xa4, 0x1a, 0x3a, 0x15, 0x74, 0x6d, 0x8c, 0x10, 0x0d, 0x18, 0x76, 0xc8,
+    0x63, 0xca, 0x46, 0xe4, 0x09, 0x61, 0x2c, 0xfa, 0x64, 0x13, 0x2c, 0x82, 0xc7, 0x06, 0x7d, 0x14,
+    0x47, 0x2e, 0xe0, 0xc1, 0x80, 0x3e, 0x88, 0x3d, 0xe8, 0x06, 0x3d, 0x61, 0xfd, 0xe8, 0xe1, 0x64,
+    0x0f, 0x06, 0xaf, 0x52, 0x4e, 0x28, 0xf8, 0x33, 0xbd, 0x52, 0x27, 0xe1, 0x34, 0xb0, 0xfd, 0xd4,
+    0x0e, 0x41, 0x29, 0x81, 0x68, 0x31, 0x2c, 0x0b, 0x7b, 0x73, 0x59, 0x75, 0x0a, 0x07, 0x0b, 0x00,
+    0xd7, 0x30, 0x0a, 0x56, 0xd3, 0xc8, 0x0b, 0x5a, 0x6d, 0x41, 0x21, 0xf8, 0xde, 0x1e, 0x7a, 0x17,
+    0x62, 0x64, 0xdd, 0xbb, 0xe6, 0xd2, 0x9e, 0xa2, 0x89, 0x19, 0xe2, 0x77, 0x81, 0x83, 0x66, 0x81,
+    0xb7, 0x24, 0xf9, 0x8b, 0x00, 0x28, 0x86, 0x7c, 0xb2, 0x6f, 0x80, 0x13, 0x49, 0xbd, 0x93, 0x02,
+    0x84, 0x68, 0x61, 0x87, 0xbd, 0xb8, 0xdf, 0x29, 0x5a, 0xdb, 0xae, 0xe5, 0xad, 0x7b, 0x71, 0xf3,
+    0x5e, 0x5c, 0x77, 0x82, 0xfe, 0x88, 0x9a, 0x7b, 0x7b, 0x4d, 0xf8, 0x95, 0x6f, 0xb1, 0xf0, 0xc2,
+    0xe8, 0x58, 0x0c, 0xd6, 0xf4, 0xed, 0xbf, 0xc7, 0xf7, 0x00, 0xd5, 0x5d, 0x39, 0x8e, 0xa4, 0x8d,
+    0x1d, 0x9e, 0x27, 0x37, 0x2f, 0x9c, 0xa2, 0x99, 0xe9, 0xe4, 0x4f, 0x34, 0x25, 0x2d, 0xf9, 0x7c,
+    0xe2, 0xca, 0x4b, 0x68, 0xfd, 0x51, 0xc8, 0x3a, 0x1b, 0xde, 0x18, 0xa1, 0x26, 0xb0, 0x46, 0xb3,
+    0x23, 0x6c, 0xc6, 0x9d, 0x75, 0x22, 0xbd, 0xe2, 0x06, 0x94, 0x99, 0x00, 0x04, 0xf0, 0x92, 0x04,
+    0xc4, 0x86, 0xb9, 0x38, 0x6f, 0x15, 0x7f, 0x62, 0x66, 0xe3, 0xbc, 0x56, 0xfc, 0xd9, 0x38, 0x8e,
+    0x80, 0x89, 0xb8, 0x49, 0xcc, 0x9f, 0x94, 0x3d, 0xc5, 0x4d, 0x88, 0x03, 0x24, 0xed, 0xcf, 0xdd,
+    0x8a, 0xf7, 0xcc, 0xad, 0x90, 0xa2, 0xba, 0x9e, 0xbc, 0x27, 0xb6, 0xa0, 0xf4, 0x7b, 0xbe, 0x83,
+    0x8f, 0xd8, 0x22, 0x89, 0xdb, 0xd0, 0xcd, 0x90, 0xb7, 0x28, 0x34, 0x78, 0x38, 0xd6, 0x27, 0x74,
+    0x18, 0x4f, 0xb8, 0x76, 0xd4, 0x6a, 0xe7, 0x8f, 0x32, 0x64, 0xfe, 0x64, 0x4d, 0x04, 0x1c, 0xc0,
+    0xf8, 0x19, 0x78, 0xf4, 0xf9, 0x2d, 0x30, 0x4b, 0x98, 0x07, 0x93, 0x34, 0x61, 0x7a, 0x8b, 0x2b,
+    0xc2, 0x67, 0x4c, 0x17, 0x49, 0x1b, 0x93, 0x36, 0xa4, 0xfa, 0xe3, 0xc2, 0x9d, 0x79, 0x1a, 0xc4,
+    0xcc, 0xf0, 0xde, 0x9d, 0x22, 0xd2, 0x01, 0x14, 0x2d, 0x70, 0xbf, 0x4c, 0x6c, 0xaf, 0x83, 0x7b,
+    0xb2, 0x55, 0xcc, 0x61, 0xc7, 0x20, 0x1a, 0xf9, 0x06, 0xe4, 0x84, 0x4a, 0x2d, 0x91, 0x2b, 0x67,
+    0x0c, 0xf2, 0x4e, 0xa4, 0xd6, 0x0b, 0x10, 0x08, 0xe0, 0xd2, 0x07, 0x35, 0x1b, 0xe2, 0xe0, 0x91,
+    0x80, 0xb9, 0x48, 0xb1, 0x3f, 0x34, 0xc6, 0x16, 0x13, 0xb4, 0x74, 0xef, 0x1e, 0xc0, 0xbe, 0x88,
+    0xf0, 0xb2, 0xd5, 0xc4, 0xa1, 0x3f, 0x1c, 0x4c, 0xcd, 0xe5, 0x7b, 0x10, 0xc8, 0xf7, 0x30, 0x52,
+    0x53, 0x30, 0x4f, 0x7b, 0x86, 0x5a, 0x09, 0xa4, 0xb6, 0x44, 0xb4, 0xb2, 0x52, 0x9d, 0x34, 0x3f,
+    0x96, 0xb1, 0x3e, 0x08, 0x22, 0x06, 0xe2, 0xcd, 0x5b, 0xcd, 0x78, 0x8e, 0x84, 0x30, 0x20, 0xe9,
+    0x85, 0xa9, 0x8a, 0x50, 0x7a, 0x40, 0x18, 0xd8, 0x48, 0x82, 0x0a, 0x90, 0xf0, 0x6a, 0x43, 0x1a,
+    0x42, 0x4a, 0x9a, 0xe7, 0x4c, 0x88, 0xd9, 0x9a, 0x01, 0xf1, 0x66, 0x76, 0x00, 0x04, 0x22, 0x9b,
+    0x18, 0x39, 0x12, 0xb1, 0xf2, 0xdb, 0x52, 0x44, 0x19, 0x18, 0x36, 0x2f, 0x46, 0xf2, 0x56, 0xf3,
+    0x79, 0x16, 0x20, 0x3d, 0x63, 0x8e, 0xc6, 0x38, 0x20, 0xae, 0xfd, 0xd2, 0x03, 0x06, 0x24, 0x23,
+    0xc0, 0xff, 0x73, 0xec, 0x82, 0x0e, 0x27, 0x0a, 0x0c, 0xda, 0xb5, 0x47, 0xa2, 0xa9, 0xc4, 0x14,
+    0x8e, 0x07, 0xf9, 0xc3, 0x1f, 0xe2, 0xf1, 0x7a, 0x51, 0x60, 0x2f, 0x5b, 0x6d, 0x19, 0xc5, 0x8b,
+    0x54, 0xcf, 0xf6, 0x3b, 0x96, 0xf6, 0xca, 0xb0, 0x42, 0x28, 0x65, 0x85, 0x4e, 0x1a, 0xbc, 0x02,
+    0x9c, 0x70, 0x35, 0x43, 0xf3, 0x16, 0x66, 0x0d, 0xb4, 0xd7, 0x2d, 0xa5, 0x76, 0x39, 0xd3, 0x43,
+    0xac, 0xcd, 0xc0, 0x6d, 0x35, 0xdf, 0x78, 0x09, 0xe9, 0x61, 0x41, 0x48, 0x61, 0x3e, 0x29, 0x7a,
+    0x08, 0xf0, 0xaf, 0x2b, 0xb0, 0x48, 0x42, 0x30, 0xc1, 0x40, 0x60, 0x4c, 0xdb, 0x91, 0x8e, 0xf6,
+    0x48, 0xfd, 0x24, 0x27, 0xb6, 0x20, 0x2b, 0xe0, 0xd0, 0x2e, 0x5e, 0x61, 0x60, 0xcf, 0x20, 0x14,
+    0x0a, 0x6d, 0x00, 0x1c, 0x14, 0xb8, 0x12, 0xfc, 0x9b, 0xe7, 0xcc, 0x3e, 0xe9, 0x5e, 0xdf, 0xfb,
+    0xb8, 0x09, 0xbb, 0x06, 0xa9, 0x71, 0xb0, 0xd9, 0x16, 0xb9, 0xf7, 0x4b, 0xe8, 0xb9, 0x4d, 0x9d,
+    0x3a, 0xcc, 0x21, 0x94, 0x56, 0x61, 0x62, 0x0d, 0xb2, 0x49, 0x56, 0x93, 0xd7, 0x4a, 0xb8, 0xf3,
+    0xa2, 0xc2, 0xb5, 0xbc, 0xe9, 0x6a, 0x09, 0x20, 0x88, 0x26, 0x78, 0xee, 0x60, 0xf2, 0xf1, 0xe9,
+    0xfd, 0x85, 0xd5, 0x6a, 0x16, 0x72, 0xd6, 0xcd, 0x76, 0xcf, 0xb4, 0xd8, 0x78, 0xaf, 0xed, 0x30,
+    0x22, 0x0c, 0xdd, 0x6a, 0x32, 0xa8, 0xc0, 0x21, 0x2d, 0xdc, 0x46, 0xa7, 0x67, 0x2a, 0x9d, 0x90,
+    0xdb, 0x9b, 0x7b, 0x9b, 0x01, 0x80, 0x63, 0x71, 0x2f, 0x02, 0x7b, 0x19, 0x47, 0x3d, 0xea, 0x57,
+    0x1f, 0xcb, 0xa1, 0x94, 0xd5, 0xc9, 0x0f, 0xf0, 0x4c, 0x44, 0x91, 0x4d, 0x3a, 0x34, 0xbe, 0x17,
+    0x41, 0xa2, 0x32, 0x37, 0x1b, 0xf7, 0x98, 0xdd, 0xc3, 0x7b, 0x2a, 0xa7, 0x55, 0x21, 0xd9, 0x29,
+    0xe2, 0xb8, 0x3c, 0xd8, 0x9f, 0xe8, 0xb5, 0x26, 0xe5, 0xa0, 0x52, 0xaa, 0x88, 0x80, 0xe6, 0xb1,
+    0x14, 0x2c, 0x11, 0x8d, 0xc3, 0xea, 0x56, 0x88, 0x21, 0x77, 0xcb, 0x51, 0xf2, 0xc9, 0x1b, 0x48,
+    0x2e, 0xc0, 0xbd, 0xc9, 0x2e, 0x4b, 0xfb, 0xb8, 0xfc, 0xea, 0x6e, 0x10, 0x03, 0x78, 0x8a, 0x45,
+    0xcd, 0xd1, 0xa3, 0x47, 0xca, 0x52, 0xb8, 0x9c, 0xa8, 0x3b, 0xa6, 0xb8, 0x81, 0x19, 0xc8, 0x7c,
+    0xe8, 0x34, 0xdd, 0x60, 0xd6, 0x5a, 0xc4, 0xb7, 0x65, 0xa8, 0x38, 0xab, 0xab, 0x61, 0xa7, 0xd8,
+    0xc8, 0xd3, 0x33, 0x53, 0x2e, 0x63, 0x2b, 0x67, 0xa5, 0xb8, 0xa1, 0x96, 0x91, 0xb2, 0x79, 0x58,
+    0x09, 0xc0, 0x14, 0x76, 0x5f, 0x0c, 0x13, 0xc5, 0x68, 0xa9, 0x39, 0x21, 0x43, 0x87, 0x5d, 0x30,
+    0x50, 0x0c, 0xf0, 0x53, 0xb0, 0x4f, 0x9c, 0x90, 0xd6, 0xb0, 0x4f, 0x6c, 0xdf, 0xeb, 0xd9, 0x27,
+    0x97, 0x6c, 0x96, 0xb3, 0x4f, 0xdc, 0x50, 0xcb, 0x3e, 0xd9, 0xec, 0xb1, 0x08, 0x60, 0x16, 0xbb,
+    0x2f, 0x86, 0x7d, 0x62, 0xb4, 0xd4, 0x7c, 0x90, 0xa1, 0xc3, 0x2e, 0xd8, 0x27, 0x06, 0xf8, 0x29,
+    0xd8, 0x67, 0x93, 0x48, 0xd5, 0x30, 0xd0, 0xc6, 0x87, 0xd4, 0xb3, 0x50, 0x21, 0x4d, 0x2a, 0x67,
+    0xa2, 0x4d, 0x53, 0x2d, 0x1b, 0xe5, 0xd3, 0x9f, 0x22, 0xa0, 0x79, 0x2c, 0xbf, 0x18, 0x56, 0xda,
+    0x20, 0xa6, 0xe6, 0x8a, 0x1c, 0x3d, 0x76, 0xc1, 0x4e, 0x1b, 0x90, 0x9f, 0x82, 0xa1, 0x48, 0x3e,
+    0x58, 0xc3, 0x4a, 0x24, 0x90, 0xa0, 0x67, 0xa2, 0x54, 0x9e, 0x57, 0xce, 0x3e, 0xa4, 0x91, 0x96,
+    0x71, 0x36, 0x99, 0x5b, 0x11, 0xa0, 0x0d, 0x36, 0x5f, 0x0c, 0xb3, 0x10, 0x94, 0xd4, 0xab, 0x9d,
+    0xcc, 0x7b, 0x17, 0x0c, 0x42, 0x80, 0x7d, 0x0a, 0xd6, 0xe0, 0xb5, 0x3a, 0x1a, 0xee, 0xe0, 0x31,
+    0x33, 0x3d, 0x83, 0x64, 0xcb, 0x70, 0xe4, 0x3c, 0xc2, 0xdb, 0x69, 0xd9, 0x24, 0x53, 0x59, 0x23,
+    0x02, 0x97, 0xc1, 0xec, 0x8b, 0x61, 0x16, 0x8e, 0x95, 0x7a, 0xf1, 0xd3, 0x34, 0xa8, 0xc5, 0x32,
+    0x5b, 0xec, 0x30, 0x99, 0x42, 0x05, 0xe9, 0xe2, 0xcb, 0xd5, 0xbe, 0xa8, 0x60, 0x61, 0xd7, 0xbe,
+    0x64, 0x36, 0x7c, 0x59, 0x6f, 0x61, 0xb6, 0x25, 0x54, 0x31, 0xc7, 0x5e, 0x9d, 0x58, 0xd9, 0x5c,
+    0xfb, 0xae, 0xa9, 0xc4, 0xa3, 0xb7, 0x9f, 0x87, 0x3c, 0xfc, 0x32, 0xc2, 0x38, 0xd5, 0xc7, 0x6b,
+    0xf8, 0xcb, 0x93, 0x26, 0x9d, 0xfe, 0x13, 0x13, 0x86, 0xdc, 0x5e, 0x42, 0xe8, 0xa2, 0x23, 0x0b,
+    0x83, 0x41, 0x53, 0x93, 0xa5, 0x27, 0x20, 0x45, 0x2b, 0x9b, 0xb3, 0xde, 0x05, 0x62, 0xaf, 0x58,
+    0x4e, 0x7d, 0x7b, 0xd4, 0xd2, 0x59, 0xe7, 0x5d, 0x20, 0xf6, 0x13, 0xc9, 0x88, 0x57, 0x59, 0x72,
+    0x96, 0xec, 0x64, 0x2b, 0x5e, 0x29, 0xf0, 0xc4, 0x12, 0xb0, 0xdb, 0xe1, 0x4c, 0xc1, 0x5c, 0x7b,
+    0x71, 0x9e, 0xb5, 0x92, 0x4b, 0xcf, 0x6f, 0xe8, 0xa9, 0x8a, 0x79, 0x2a, 0x4b, 0xbb, 0x25, 0xbd,
+    0xcd, 0x1b, 0x4c, 0xaf, 0x3c, 0xa9, 0xa4, 0x7f, 0x36, 0x47, 0x4f, 0x2b, 0x28, 0x9c, 0xcc, 0x29,
+    0xc2, 0xda, 0x58, 0xb3, 0x5d, 0x11, 0x36, 0x50, 0xd5, 0x06, 0x9d, 0x39, 0x2f, 0xa9, 0x8a, 0x80,
+    0x43, 0x83, 0x1e, 0xa9, 0x1b, 0x44, 0xa7, 0xa7, 0xa7, 0xa8, 0x19, 0x1f, 0xba, 0x6c, 0xb6, 0xd1,
+    0x47, 0xb4, 0xf9, 0x0a, 0x35, 0xc9, 0x3e, 0xd8, 0x3c, 0x16, 0x44, 0x71, 0xa9, 0x57, 0x47, 0xe3,
+    0xc8, 0x99, 0xf6, 0x09, 0x20, 0x51, 0x9f, 0x6a, 0xa2, 0x95, 0x3d, 0xa2, 0xa6, 0x24, 0x1b, 0x4b,
+    0xf6, 0xe8, 0x89, 0x17, 0x6a, 0x49, 0xb7, 0x39, 0xab, 0x0b, 0x03, 0xde, 0x32, 0x53, 0x40, 0x11,
+    0xe0, 0x67, 0x60, 0xab, 0xac, 0x48, 0x4f, 0x1d, 0x64, 0x21, 0xd1, 0xcb, 0xf4, 0xde, 0xa1, 0x06,
+    0x9b, 0x1c, 0x99, 0x8c, 0xe1, 0xaa, 0xd1, 0x24, 0x89, 0xe5, 0x8f, 0xc9, 0xd9, 0xf8, 0x11, 0x9a,
+    0x3c, 0xc8, 0xf9, 0x23, 0x6c, 0x43, 0xfb, 0x1e, 0x21, 0x07, 0xc9, 0x30, 0xc9, 0xdb, 0xf9, 0xb4,
+    0x5d, 0xbc, 0xec, 0x04, 0x75, 0x15, 0x0a, 0x81, 0x96, 0x52, 0xec, 0x14, 0x9e, 0x8c, 0x73, 0x83,
+    0x1e, 0xad, 0x17, 0xe9, 0xc5, 0x2f, 0x77, 0x00, 0x8e, 0xa3, 0x75, 0xd9, 0x4d, 0x59, 0xf3, 0xac,
+    0x1d, 0xd7, 0x7c, 0x42, 0xd8, 0x89, 0x5d, 0x07, 0xd0, 0x54, 0x8f, 0xb0, 0x29, 0x48, 0x21, 0xfd,
+    0xbe, 0x1e, 0xf4, 0xbf, 0x3f, 0x9c, 0x0d, 0x25, 0x7d, 0xa2, 0xe0, 0x5e, 0x93, 0x4e, 0x89, 0x48,
+    0x36, 0x1c, 0x00, 0x99, 0x6b, 0xd3, 0x8e, 0xd0, 0x0c, 0x47, 0xd3, 0x45, 0xab, 0xb9, 0x47, 0x26,
+    0x0c, 0xdc, 0xfb, 0x71, 0x89, 0xa3, 0x85, 0x67, 0x8d, 0x50, 0xf3, 0xea, 0x72, 0x7c, 0x0d, 0x0f,
+    0x16, 0x2c, 0xfb, 0x31, 0x62, 0x8a, 0x2a, 0x9f, 0x12, 0xe9, 0xd0, 0x57, 0x37, 0x8f, 0xd0, 0x9f,
+    0xc7, 0x97, 0x6f, 0x00, 0x59, 0x72, 0x77, 0x93, 0x3d, 0xbb, 0x6f, 0xf9, 0x4e, 0xfb, 0x41, 0x93,
+    0x37, 0x8a, 0x90, 0x95, 0xe0, 0x00, 0xf8, 0xf4, 0x48, 0x3e, 0x44, 0x95, 0xba, 0x22, 0xeb, 0x6b,
+    0xf1, 0x77, 0x33, 0x30, 0x3d, 0x11, 0xae, 0xa6, 0x53, 0x12, 0xf3, 0x55, 0xa5, 0xc9, 0x14, 0x54,
+    0xdc, 0x9f, 0x9a, 0xb3, 0x03, 0xa3, 0x79, 0xac, 0xe9, 0x9b, 0x5d, 0x34, 0xab, 0xb7, 0x84, 0x21,
+    0xcd, 0x39, 0x56, 0x77, 0x23, 0x3b, 0x91, 0xbd, 0xc4, 0xde, 0x2a, 0x6a, 0x31, 0x45, 0x90, 0x54,
+    0x46, 0x04, 0x98, 0x98, 0x53, 0x84, 0x70, 0x03, 0xc3, 0x30, 0x14, 0xf3, 0xd5, 0x66, 0xc6, 0x14,
+    0x53, 0x63, 0xc5, 0x49, 0x95, 0xa7, 0x86, 0x89, 0x19, 0x82, 0xfe, 0xf6, 0x37, 0xd4, 0x7c, 0x4e,
+    0x3e, 0x29, 0xfa, 0x3f, 0x48, 0x92, 0x79, 0x30, 0xc9, 0xe9, 0x82, 0x1a, 0xaa, 0x72, 0xbc, 0x25,
+    0x38, 0xbf, 0x78, 0xf1, 0xe4, 0xc0, 0x50, 0x2d, 0x47, 0x41, 0x7e, 0x92, 0xa2, 0x0f, 0x9a, 0x56,
+    0xc3, 0xd6, 0x57, 0xe8, 0x19, 0x7d, 0x1f, 0x3a, 0xb0, 0x53, 0x7c, 0xd9, 0x04, 0x15, 0x2e, 0x30,
+    0x4b, 0xe2, 0x77, 0x34, 0xd0, 0xb2, 0x17, 0xf0, 0xd5, 0x0f, 0x60, 0x85, 0xa0, 0x8d, 0x15, 0xca,
+    0x65, 0xaf, 0xec, 0x32, 0x1e, 0xc8, 0x97, 0x51, 0xbc, 0xe9, 0x68, 0xeb, 0x04, 0x44, 0x3e, 0x3f,
+    0xbf, 0xbc, 0x2f, 0x76, 0xfa, 0xc5, 0xc9, 0x3f, 0x7e, 0x5c, 0x36, 0xb9, 0xe8, 0xcf, 0x24, 0x97,
+    0x0e, 0x32, 0xda, 0x90, 0x49, 0x07, 0x18, 0xbc, 0x32, 0x9a, 0xf7, 0x8e, 0x16, 0x40, 0xf7, 0xf9,
+    0x02, 0x7e, 0x63, 0xc4, 0x6e, 0x4d, 0x7c, 0xa4, 0x4a, 0xed, 0x7e, 0xf8, 0xe6, 0x23, 0x87, 0xf9,
+    0x10, 0x97, 0x76, 0x91, 0xfc, 0xee, 0x37, 0x1f, 0x29, 0x32, 0x0f, 0x1f, 0xd4, 0x93, 0xca, 0x58,
+    0xdf, 0x02, 0xc4, 0xb9, 0x29, 0x11, 0x5e, 0x92, 0x10, 0x8a, 0xd0, 0x8d, 0xa1, 0x9e, 0x00, 0x93,
+    0x79, 0xcf, 0x6d, 0x96, 0xab, 0x04, 0x8a, 0x3b, 0x31, 0xc0, 0x7f, 0xc7, 0x2a, 0x76, 0xd0, 0x48,
+    0x05, 0x81, 0x4d, 0x8d, 0xb9, 0x2d, 0x4f, 0xa9, 0x25, 0x98, 0x73, 0x42, 0x3a, 0x28, 0xfe, 0x9b,
+    0x18, 0x22, 0xf0, 0x17, 0x9d, 0x14, 0x7c, 0xf8, 0x8a, 0x0c, 0xb2, 0x4d, 0x51, 0x89, 0x90, 0x64,
+    0x89, 0x5f, 0x20, 0xab, 0x68, 0xc9, 0x4f, 0x99, 0xbb, 0x26, 0x30, 0xe9, 0xaf, 0x54, 0xdf, 0x57,
+    0x98, 0x7e, 0xce, 0xd9, 0x81, 0x29, 0x27, 0x4f, 0x38, 0x09, 0x0a, 0xa5, 0xc1, 0x71, 0xf1, 0x80,
+    0x64, 0xf0, 0x9d, 0x53, 0x89, 0x3b, 0x29, 0x65, 0x69, 0x44, 0x7d, 0x24, 0x29, 0x85, 0xe8, 0xb7,
+    0x15, 0xe8, 0x93, 0xf1, 0xb8, 0x80, 0x1a, 0xfc, 0x6f, 0x4e, 0x9b, 0x4c, 0x65, 0xb1, 0x8c, 0x2e,
+    0xb4, 0xcb, 0x0e, 0xa9, 0x22, 0x40, 0x93, 0xb9, 0x35, 0x17, 0x56, 0x87, 0xde, 0x01, 0x40, 0x7e,
+    0xd3, 0xfa, 0xdc, 0x0e, 0x95, 0x0d, 0xb9, 0x48, 0x72, 0xcf, 0x5d, 0x6e, 0x24, 0xc5, 0x70, 0x45,
+    0x69, 0x6a, 0xfa, 0x55, 0x8f, 0x16, 0x35, 0xd2, 0x8b, 0x08, 0x4f, 0xd1, 0x87, 0x6c, 0x99, 0xef,
+    0x37, 0x1f, 0x13, 0xc9, 0x74, 0x99, 0x60, 0x82, 0x80, 0x3e, 0x7c, 0x50, 0xce, 0xad, 0xe0, 0xe2,
+    0x49, 0x8b, 0x20, 0xc0, 0x0d, 0xa5, 0x87, 0xe8, 0x62, 0x55, 0x08, 0xea, 0xca, 0x62, 0xbd, 0x98,
+    0x06, 0x0d, 0xff, 0xbf, 0x9c, 0xf0, 0x7f, 0x6b, 0x39, 0xa1, 0xb0, 0x1e, 0x96, 0x0a, 0x05, 0x65,
+    0x89, 0x77, 0x17, 0x60, 0x58, 0x51, 0x1e, 0x0e, 0xb7, 0xab, 0x8d, 0x89, 0x43, 0xc2, 0x74, 0xfd,
+    0x4b, 0x54, 0x31, 0x26, 0x8c, 0xc9, 0xe2, 0xdf, 0x15, 0x46, 0x17, 0x54, 0x9b, 0x24, 0xa3, 0x1b,
+    0xc7, 0xb5, 0xe0, 0xf0, 0x98, 0x79, 0xde, 0xa4, 0x12, 0xd9, 0x5f, 0xe5, 0xeb, 0x16, 0x12, 0xa4,
+    0x06, 0x75, 0xa0, 0x48, 0x50, 0x1a, 0x54, 0x41, 0x49, 0x90, 0xc8, 0x4c, 0x90, 0xea, 0xd7, 0x83,
+    0x23, 0x41, 0xab, 0x5f, 0x05, 0xad, 0x42, 0x8a, 0x3e, 0x41, 0x6a, 0x68, 0x18, 0x75, 0xe0, 0x48,
+    0x90, 0x1a, 0x1a, 0x95, 0x16, 0x30, 0x93, 0xb1, 0xab, 0x45, 0xa7, 0x74, 0xa6, 0x6e, 0x2b, 0x0a,
+    0xe5, 0x73, 0x43, 0x1b, 0x6c, 0x8c, 0x1a, 0x50, 0x64, 0x18, 0x19, 0xd5, 0xe4, 0x94, 0x1d, 0x89,
+    0xb3, 0x02, 0xcf, 0xb7, 0xbc, 0xb5, 0x1b, 0x6e, 0x9f, 0x02, 0x49, 0x54, 0x46, 0xa5, 0x65, 0x2a,
+    0xe4, 0x08, 0x94, 0x60, 0xe4, 0xf3, 0x61, 0xfb, 0x2f, 0x62, 0xfb, 0xaf, 0x6c, 0x07, 0x2c, 0x61,
+    0x04, 0x93, 0xc2, 0xfd, 0x94, 0xf1, 0x4b, 0x15, 0x71, 0x7b, 0x1b, 0xa3, 0x92, 0x03, 0x14, 0x99,
+    0x92, 0x95, 0x81, 0xe7, 0x2c, 0x32, 0x0e, 0x3a, 0x6f, 0x89, 0xc9, 0xc0, 0x2a, 0xf6, 0x0e, 0x7e,
+    0xe6, 0x24, 0x3e, 0x83, 0xbf, 0x5d, 0x01, 0xb9, 0xd2, 0xdd, 0xda, 0x38, 0xb6, 0x41, 0x7c, 0x78,
+    0x88, 0xdb, 0x2e, 0x61, 0xb3, 0x8c, 0xff, 0x98, 0x0a, 0x26, 0x4b, 0x6d, 0xbb, 0x8f, 0x29, 0x13,
+    0xa6, 0x13, 0xdb, 0x29, 0x1d, 0x66, 0x8f, 0x74, 0x52, 0x46, 0x47, 0x27, 0xb1, 0x2e, 0x3a, 0x29,
+    0x33, 0xa2, 0x93, 0xd8, 0x0b, 0x1d, 0x6a, 0x16, 0x74, 0x72, 0xfb, 0x7f, 0x27, 0xde, 0xe8, 0x3b,
+    0xf1, 0x8e, 0xde, 0x61, 0xdb, 0x36, 0x7a, 0x90, 0xf8, 0x78, 0x25, 0x97, 0x22, 0xc4, 0x88, 0x84,
+    0xa5, 0xd0, 0x5e, 0xe8, 0x9a, 0x7e, 0x08, 0x73, 0x44, 0xc0, 0xcc, 0x0b, 0x82, 0x36, 0x29, 0x79,
+    0x27, 0x67, 0x62, 0x48, 0x18, 0xbf, 0xe5, 0xc2, 0x17, 0x80, 0x3d, 0xf8, 0xa9, 0x6d, 0xc9, 0xfc,
+    0x57, 0xf4, 0x60, 0x0b, 0x38, 0xb6, 0xe9, 0xa3, 0x2e, 0x0f, 0x09, 0xd8, 0x0f, 0xb2, 0xdc, 0x74,
+    0xcc, 0x05, 0x65, 0x0c, 0xc3, 0x14, 0x85, 0xd5, 0xd6, 0x61, 0x12, 0x60, 0xe5, 0x4f, 0xda, 0x4a,
+    0x63, 0x31, 0xeb, 0x0d, 0xeb, 0xad, 0xc6, 0xd4, 0x62, 0x6a, 0xcc, 0xc7, 0x64, 0xa9, 0xb5, 0x56,
+    0x64, 0x8a, 0x15, 0x34, 0xe6, 0x64, 0xc2, 0x28, 0x0a, 0x9b, 0x92, 0xb2, 0x50, 0x29, 0xb3, 0x32,
+    0xc7, 0x66, 0x6a, 0x1b, 0x33, 0xe6, 0x41, 0xb5, 0xa5, 0x19, 0x33, 0xa8, 0xca, 0xd6, 0xa4, 0xbf,
+    0x6a, 0x1d, 0x5d, 0xd9, 0xe8, 0x0f, 0xb0, 0x3b, 0x41, 0x90, 0x81, 0xb9, 0xd6, 0xfc, 0x85, 0x0b,
+    0x24, 0x1e, 0x45, 0xc2, 0x99, 0x58, 0x56, 0xed, 0xc9, 0x92, 0x4b, 0x4f, 0x23, 0x57, 0x59, 0xea,
+    0x99, 0x4e, 0x41, 0x49, 0x8b, 0xb6, 0xd8, 0x2d, 0xfb, 0x97, 0xfc, 0x7d, 0x45, 0xaa, 0x9a, 0xad,
+    0xec, 0x9b, 0x03, 0xe4, 0x20, 0x41, 0x57, 0xcf, 0x6d, 0xd7, 0x74, 0xae, 0xc9, 0xeb, 0x5c, 0x4e,
+    0x53, 0xc8, 0xa6, 0x37, 0x5d, 0x41, 0x67, 0x61, 0x3b, 0xb2, 0x97, 0x25, 0x77, 0xff, 0x8b, 0x43,
+    0x72, 0xa9, 0x8e, 0xa0, 0x81, 0xcd, 0x89, 0x43, 0x8f, 0x86, 0x81, 0xc8, 0x0b, 0x22, 0xb1, 0xd9,
+    0xe9, 0x16, 0xa3, 0xf4, 0xe4, 0x76, 0xce, 0x32, 0x3b, 0xa7, 0x3c, 0x94, 0x9e, 0x84, 0xd1, 0x7d,
+    0xf8, 0x80, 0x73, 0xb1, 0x74, 0xd0, 0x2d, 0x1d, 0x45, 0xfc, 0x33, 0x17, 0x60, 0x97, 0xb6, 0xd3,
+    0x04, 0xde, 0xa5, 0xfd, 0xc4, 0x01, 0x79, 0xa6, 0xb7, 0xc4, 0x67, 0x5d, 0x64, 0xa1, 0x7a, 0x69,
+    0x9e, 0x25, 0x9e, 0x78, 0xcf, 0xbb, 0x69, 0x6b, 0x93, 0x0d, 0x13, 0xc7, 0x9b, 0xa4, 0x23, 0xfd,
+    0xac, 0x27, 0x79, 0xda, 0xd2, 0xa6, 0x08, 0xe8, 0xfb, 0x52, 0xd8, 0x21, 0xc4, 0x77, 0x6f, 0x5f,
+    0xf7, 0xa6, 0x01, 0x06, 0x79, 0xb9, 0x9c, 0xfc, 0x02, 0xc2, 0x0f, 0x7f, 0xb7, 0x08, 0x10, 0x05,
+    0x0c, 0xe9, 0x17, 0x20, 0x95, 0x7c, 0x73, 0xa6, 0x21, 0x50, 0xce, 0x5b, 0x16, 0x1b, 0xae, 0x0c,
+    0x4a, 0xcf, 0x12, 0x66, 0x52, 0x08, 0x66, 0xfa, 0x95, 0x27, 0x4d, 0xed, 0x54, 0x53, 0x57, 0xc3,
+    0x96, 0x00, 0x9b, 0x6a, 0xad, 0x07, 0xed, 0x15, 0xe5, 0xfe, 0xd7, 0x15, 0x0e, 0xee, 0xc7, 0xd4,
+    0xa0, 0xf4, 0x82, 0x56, 0xb3, 0x97, 0x79, 0x77, 0x4a, 0xb3, 0x0e, 0x4d, 0xd3, 0x74, 0xe9, 0x85,
+    0xc1, 0x94, 0x84, 0x5e, 0xf9, 0xea, 0x1d, 0x97, 0xec, 0x54, 0x25, 0x9b, 0x46, 0x7e, 0x52, 0x44,
+    0x28, 0x76, 0x26, 0x97, 0x5e, 0x2a, 0xfa, 0x7a, 0x32, 0xe5, 0xa0, 0x1b, 0x54, 0xfa, 0x85, 0xca,
+    0xc3, 0xcd, 0xbe, 0x35, 0x06, 0x4c, 0xf8, 0x74, 0x60, 0xac, 0x59, 0x78, 0x3d, 0x7b, 0xfe, 0x9d,
+    0xe7, 0x0a, 0x74, 0xa4, 0xa3, 0xa6, 0x5f, 0x37, 0x53, 0x74, 0x85, 0xd8, 0x7b, 0x95, 0x62, 0xc6,
+    0xaf, 0x33, 0xdd, 0x8c, 0xc5, 0x9a, 0x05, 0x87, 0x78, 0x66, 0x6e, 0x06, 0xc6, 0xb7, 0x92, 0x99,
+    0x2a, 0xd9, 0xcc, 0x65, 0xa4, 0x9a, 0xef, 0xb5, 0x1b, 0x8a, 0x73, 0x52, 0x2a, 0xb3, 0x8a, 0x5f,
+    0xe5, 0xcf, 0x1c, 0xeb, 0x12, 0x8a, 0x82, 0x33, 0xca, 0xe2, 0x8d, 0x48, 0x97, 0x2e, 0x2b, 0x71,
+    0xf6, 0x2d, 0x42, 0x34, 0x2b, 0xf7, 0xcc, 0x8c, 0xcc, 0xa2, 0x12, 0xd5, 0xe5, 0x4c, 0x49, 0x9e,
+    0x67, 0x0d, 0x96, 0xf0, 0x1a, 0xd1, 0x84, 0x5e, 0x2b, 0x01, 0x95, 0x4a, 0xf5, 0xbd, 0x30, 0x6d,
+    0x87, 0xe5, 0x73, 0xe2, 0xf7, 0x54, 0x51, 0xce, 0xa9, 0x70, 0x84, 0x2e, 0xc9, 0xfa, 0xd1, 0xf8,
+    0xbe, 0x62, 0xc7, 0x24, 0xec, 0x42, 0x1b, 0xb5, 0x64, 0xa3, 0x8e, 0xc0, 0x37, 0xc3, 0x92, 0x34,
+    0xc1, 0xee, 0xf5, 0x59, 0x2d, 0x1d, 0xb0, 0x7b, 0x31, 0x87, 0x81, 0x75, 0x92, 0x5e, 0x53, 0xca,
+    0x9f, 0xbf, 0x7d, 0x7b, 0xf9, 0x16, 0x2c, 0x0d, 0xf4, 0x47, 0x46, 0x55, 0x75, 0xf2, 0xba, 0xfc,
+    0xd1, 0xfb, 0x07, 0x34, 0x23, 0xb6, 0x9f, 0x23, 0x35, 0x8f, 0x64, 0x56, 0x5e, 0xda, 0x6a, 0x3c,
+    0xd6, 0x75, 0x4d, 0xd9, 0x79, 0x12, 0x3c, 0xca, 0x18, 0x7b, 0x92, 0x7d, 0xa0, 0x70, 0xf0, 0x53,
+    0x72, 0x60, 0x7b, 0x73, 0xc2, 0x5b, 0x94, 0x61, 0xd2, 0x18, 0x88, 0xdc, 0x84, 0x23, 0xde, 0xa2,
+    0xa2, 0xba, 0x25, 0x7d, 0xd6, 0x56, 0xa1, 0x0d, 0x38, 0xb0, 0x7f, 0x68, 0x12, 0x3b, 0x90, 0x84,
+    0x4a, 0xd8, 0x11, 0x81, 0x7f, 0x24, 0x93, 0x7c, 0x8a, 0xcd, 0x00, 0xec, 0x06, 0xb2, 0xd0, 0x29,
+    0x68, 0x65, 0x25, 0x58, 0x6b, 0xd1, 0x16, 0xfd, 0x64, 0xca, 0x70, 0x1f, 0x3a, 0x7a, 0x74, 0x47,
+    0xf1, 0x87, 0x4a, 0x96, 0x67, 0x65, 0x23, 0xd3, 0xaa, 0xa5, 0x1f, 0x4b, 0x6c, 0x25, 0xb4, 0xc8,
+    0x8e, 0xbc, 0xd7, 0x23, 0x58, 0x8a, 0xef, 0xca, 0x28, 0x57, 0x3a, 0x46, 0x6a, 0x97, 0x0a, 0xf2,
+    0x49, 0x90, 0xa6, 0xef, 0x75, 0xa4, 0xa5, 0x4d, 0xc7, 0x35, 0x41, 0xdb, 0xbe, 0x02, 0xb0, 0xed,
+    0xd7, 0x05, 0x4b, 0x5c, 0x67, 0x05, 0x60, 0xf2, 0x75, 0x5d, 0xd0, 0xfc, 0x8d, 0x42, 0x0a, 0xe8,
+    0xbc, 0x45, 0x6d, 0xdc, 0xcd, 0xa9, 0x0a, 0x75, 0x73, 0x5a, 0x17, 0x70, 0x7c, 0xf3, 0x89, 0x02,
+    0x7a, 0x72, 0x39, 0x0a, 0xd9, 0x5c, 0xdf, 0xb9, 0x37, 0xae, 0xb7, 0x76, 0x9b, 0x75, 0xc7, 0xa3,
+    0x6f, 0xc3, 0x51, 0xf1, 0x0d, 0xbd, 0xae, 0x7f, 0x17, 0x23, 0x25, 0x95, 0x78, 0x8a, 0xd1, 0x92,
+    0x36, 0x3b, 0x19, 0x91, 0xbf, 0x21, 0x4b, 0x31, 0x5e, 0x74, 0xf7, 0x9e, 0x36, 0x29, 0x39, 0x5c,
+    0x09, 0x69, 0x66, 0xef, 0x17, 0xa3, 0x35, 0x2f, 0xe4, 0xa5, 0x1c, 0x2c, 0x7a, 0x78, 0x6b, 0x87,
+    0x2b, 0x78, 0x98, 0xec, 0xcb, 0xba, 0xe2, 0x39, 0x10, 0xd6, 0x0c, 0x9a, 0xe4, 0x81, 0xce, 0x05,
+    0x63, 0x03, 0x5f, 0xe1, 0x80, 0xdc, 0xbc, 0x4f, 0x8a, 0x90, 0x32, 0xab, 0x48, 0xbf, 0x7c, 0xef,
+    0x6f, 0xbe, 0x85, 0x09, 0x1b, 0x8a, 0x5b, 0x1c, 0x70, 0x0c, 0xf0, 0xc7, 0xe4, 0x2c, 0x49, 0xf3,
+    0xca, 0x53, 0x56, 0x6c, 0x51, 0x8d, 0x4a, 0x30, 0x3f, 0x43, 0xdd, 0x03, 0xa3, 0x5d, 0xec, 0xff,
+    0xfc, 0x6e, 0x8a, 0x1d, 0x07, 0xc6, 0x57, 0x00, 0xa1, 0xf6, 0x6a, 0x1a, 0xd2, 0xa1, 0x08, 0xd2,
+    0x4b, 0xcf, 0xb3, 0xaa, 0x00, 0x79, 0x2c, 0x02, 0x02, 0x06, 0x62, 0x50, 0x5f, 0x6c, 0x28, 0xb4,
+    0x02, 0x67, 0xc1, 0x36, 0x46, 0xc6, 0x7c, 0x40, 0xd6, 0xd3, 0x25, 0x6a, 0x7d, 0xf3, 0x31, 0xbf,
+    0x28, 0x0f, 0xdf, 0xa2, 0x2e, 0x8a, 0x1f, 0x73, 0x5c, 0x1e, 0xda, 0x1f, 0x3e, 0x91, 0x2b, 0x12,
+    0x5f, 0xdc, 0x42, 0x1a, 0x5d, 0x24, 0x36, 0xa2, 0xb6, 0x46, 0x38, 0x67, 0x54, 0xea, 0xa3, 0x01,
+    0xac, 0x07, 0x8f, 0xdb, 0x95, 0x02, 0x4e, 0xeb, 0x59, 0x74, 0xa5, 0x99, 0x09, 0x37, 0x4f, 0xcb,
+    0xba, 0x51, 0xb9, 0xa9, 0xee, 0xce, 0x27, 0xde, 0x00, 0x27, 0xb3, 0x2c, 0x04, 0x1a, 0x4b, 0x40,
+    0x28, 0x55, 0x7c, 0x59, 0x0b, 0xff, 0x12, 0xc6, 0xbe, 0x7e, 0x0a, 0xcf, 0xca, 0x01, 0x79, 0xf8,
+    0x34, 0x1e, 0x1c, 0x4d, 0x88, 0x24, 0x76, 0x92, 0xce, 0x85, 0xab, 0xc0, 0x71, 0x05, 0x77, 0x86,
+    0x3a, 0xad, 0x71, 0x2d, 0x67, 0x32, 0x62, 0x19, 0xeb, 0xbe, 0x58, 0x21, 0x95, 0x0f, 0x38, 0x48,
+    0x53, 0x65, 0x3c, 0x74, 0x9a, 0xda, 0xa0, 0xa4, 0xce, 0x58, 0xf6, 0x5a, 0x3a, 0x79, 0xf0, 0x9c,
+    0x5c, 0x99, 0xf7, 0x8e, 0x17, 0x52, 0x2a, 0xe0, 0xa5, 0x6f, 0xd6, 0x6b, 0x96, 0xcd, 0x22, 0x56,
+    0xcb, 0x51, 0x69, 0x2e, 0x6a, 0xd1, 0x24, 0xae, 0x54, 0xe7, 0x1b, 0x95, 0x39, 0x2c, 0x79, 0xc5,
+    0xa6, 0x3e, 0x9f, 0xa5, 0xb9, 0x7d, 0x44, 0x97, 0xe4, 0x52, 0xde, 0x3b, 0xa1, 0xcf, 0x7c, 0x69,
+    0x0e, 0x8b, 0xeb, 0xd2, 0x61, 0xca, 0x6b, 0x0b, 0x54, 0x39, 0x32, 0xe9, 0xb9, 0xe3, 0x72, 0x89,
+    0xb3, 0x12, 0x87, 0x28, 0x35, 0xd9, 0x34, 0xd5, 0x01, 0x43, 0x4d, 0x8a, 0x4d, 0x55, 0x0f, 0xaa,
+    0xcc, 0xbb, 0xc9, 0x0b, 0x26, 0xc5, 0xdd, 0x92, 0x9b, 0x29, 0x47, 0x34, 0xe8, 0xf5, 0x0c, 0x04,
+    0xa7, 0x05, 0x5a, 0xc4, 0xbb, 0x18, 0x5f, 0x8e, 0x69, 0x2a, 0x44, 0x96, 0x37, 0x21, 0x17, 0x5f,
+    0x61, 0xd7, 0xa2, 0x6f, 0x75, 0x1a, 0x29, 0xd2, 0xc2, 0xe2, 0xde, 0x65, 0x32, 0x3a, 0x5c, 0x27,
+    0xbc, 0x27, 0x67, 0x93, 0xea, 0xdc, 0x04, 0x25, 0x94, 0xf7, 0xac, 0x6a, 0xca, 0xa9, 0x4b, 0x71,
+    0x06, 0x28, 0x2e, 0x89, 0x18, 0x08, 0xf4, 0x49, 0x4a, 0x2d, 0xe5, 0x2d, 0xa7, 0xec, 0xb5, 0x9e,
+    0xdf, 0x7c, 0xcc, 0x90, 0xf7, 0x35, 0xb9, 0xe8, 0x0b, 0x93, 0x4a, 0xf9, 0x98, 0xca, 0xc5, 0x3a,
+    0x4e, 0x81, 0x2e, 0x06, 0x23, 0xe9, 0xc2, 0xb5, 0x23, 0xe0, 0x40, 0xfb, 0x37, 0xcc, 0x12, 0x31,
+    0x9b, 0x2b, 0x2f, 0xd7, 0x0b, 0xec, 0xd2, 0x67, 0xfc, 0xa6, 0x4a, 0xd3, 0xda, 0x58, 0x4e, 0x89,
+    0xc2, 0x2c, 0x1e, 0xc2, 0x7a, 0x76, 0xf9, 0x03, 0xc7, 0xfa, 0x35, 0xbd, 0x54, 0x4e, 0x72, 0x8c,
+    0x8d, 0x86, 0x44, 0x45, 0x57, 0x6d, 0xa6, 0xa3, 0x05, 0x71, 0x70, 0xe2, 0x64, 0x2f, 0xbe, 0xab,
+    0xf3, 0x64, 0x8f, 0x24, 0xd7, 0xc8, 0xef, 0x45, 0xb4, 0x74, 0xce, 0xfe, 0x07, 0x04, 0xb9, 0x20,
+    0x96, 0xeb, 0xad, 0x00, 0x00,
+};
+
+#endif // WEBPAGE_GZ_H
@@ -1,4 +1,11 @@
 #include "webserver.h"
+#include "logger.h"
+#include "metrics.h"
+#include "motion.h"
+#include "recorder.h"
+#include "webpage_gz.h"
+#include "esp_heap_caps.h"
+#include "esp_system.h"
 #include "esp_task_wdt.h"
 #include "esp_wifi.h"
 
@@ -7,7 +14,106 @@ WebServerManager webServerManager;
 
 WebServerManager::WebServerManager()
     : server(nullptr), server_running(false), server_port(80),
-      total_requests(0), error_requests(0), last_request_time(0) {}
+      server_task_handle(nullptr), total_requests(0), error_requests(0),
+      last_request_time(0), request_pool(nullptr), response_slab(nullptr),
+      status_cache_len(0), status_cache_time(0) {
+  for (int i = 0; i < MAX_CLIENT_SLOTS; i++) {
+    client_slots[i].request = nullptr;
+    client_slots[i].in_use = false;
+  }
+
+  capture_bucket.tokens = CAPTURE_BUCKET_CAPACITY;
+  capture_bucket.capacity = CAPTURE_BUCKET_CAPACITY;
+  capture_bucket.refill_interval_ms = CAPTURE_BUCKET_REFILL_MS;
+  capture_bucket.last_refill = 0;
+
+  status_bucket.tokens = STATUS_BUCKET_CAPACITY;
+  status_bucket.capacity = STATUS_BUCKET_CAPACITY;
+  status_bucket.refill_interval_ms = STATUS_BUCKET_REFILL_MS;
+  status_bucket.last_refill = 0;
+}
+
+/**
+ * Refill a bucket by elapsed time and take one token if available
+ */
+bool WebServerManager::takeToken(TokenBucket &bucket) {
+  unsigned long now = millis();
+  unsigned long elapsed = now - bucket.last_refill;
+  if (elapsed >= bucket.refill_interval_ms) {
+    unsigned long refill = elapsed / bucket.refill_interval_ms;
+    unsigned long tokens = bucket.tokens + refill;
+    bucket.tokens = tokens > bucket.capacity ? bucket.capacity : tokens;
+    bucket.last_refill = now;
+  }
+
+  if (bucket.tokens == 0) {
+    return false;
+  }
+  bucket.tokens--;
+  return true;
+}
+
+/**
+ * Admission control: token bucket per endpoint class plus a heap floor for
+ * capture work. Rejections cost a few microseconds and a canned 503 with
+ * Retry-After instead of queueing work until the device reboots itself.
+ */
+bool WebServerManager::admitRequest(const HttpRequest &request,
+                                    WiFiClient &client, bool keep_alive) {
+  bool is_capture =
+      strcmp(request.path, "/snapshot") == 0 ||
+      strcmp(request.path, "/snap") == 0 ||
+      strcmp(request.path, "/burst") == 0 ||
+      strcmp(request.path, "/stream") == 0;
+
+  bool rejected;
+  if (is_capture) {
+    rejected = esp_get_free_heap_size() < ADMISSION_HEAP_FLOOR ||
+               !takeToken(capture_bucket);
+  } else {
+    rejected = !takeToken(status_bucket);
+  }
+
+  if (!rejected) {
+    return true;
+  }
+
+  error_requests++;
+  char headers[160];
+  int len = snprintf(headers, sizeof(headers),
+                     "HTTP/1.1 503 Service Unavailable\r\n"
+                     "Content-Type: text/plain\r\n"
+                     "Content-Length: 8\r\n"
+                     "Retry-After: %d\r\n"
+                     "Connection: %s\r\n\r\n"
+                     "Overload",
+                     ADMISSION_RETRY_AFTER_S,
+                     keep_alive ? "keep-alive" : "close");
+  client.write((const uint8_t *)headers, len);
+  return false;
+}
+
+/**
+ * Entry point for the dedicated server task. Subscribes itself to the task
+ * watchdog and services clients until stop() clears server_running.
+ */
+static void webServerTask(void *param) {
+  WebServerManager *manager = (WebServerManager *)param;
+
+  esp_task_wdt_add(NULL);
+
+  while (manager->isRunning()) {
+    esp_task_wdt_reset();
+    manager->handleClients();
+    vTaskDelay(1); // Yield so the idle task and WiFi stack get CPU time
+  }
+
+  esp_task_wdt_delete(NULL);
+  // The task owns clearing its handle so stop()/begin() can tell when it
+  // has really exited and never spawn a second worker alongside it
+  manager->notifyServerTaskExit();
+  vTaskDelete(NULL);
+}
 
 bool WebServerManager::begin(uint16_t port) {
   if (server) {
@@ -15,6 +121,22 @@ bool WebServerManager::begin(uint16_t port) {
   }
 
   server_port = port;
+
+  // Reserve the request/response arena up front and keep it for the life of
+  // the process (stop()/begin() cycles reuse it), so serving traffic never
+  // allocates and long uptimes stop eroding the largest free block
+  if (!request_pool) {
+    request_pool =
+        (HttpRequest *)malloc(sizeof(HttpRequest) * MAX_CLIENT_SLOTS);
+  }
+  if (!response_slab) {
+    response_slab = (ApiResponse *)malloc(sizeof(ApiResponse));
+  }
+  if (!request_pool || !response_slab) {
+    Serial.println("Failed to allocate request/response arena");
+    return false;
+  }
+
   server = new WiFiServer(port);
 
   if (!server) {
@@ -26,16 +148,48 @@ bool WebServerManager::begin(uint16_t port) {
   server_running = true;
 
   Serial.printf("HTTP server started on port %d\n", port);
+
+#if WEBSERVER_USE_DEDICATED_TASK
+  // Spawn the HTTP worker pinned to core 0; capture keeps core 1. If task
+  // creation fails we fall back to being driven from loop() via
+  // handleClients() - hasDedicatedTask() tells main.cpp which mode is active.
+  if (!server_task_handle) {
+    BaseType_t created = xTaskCreatePinnedToCore(
+        webServerTask, "webserver", WEBSERVER_TASK_STACK_SIZE, this,
+        WEBSERVER_TASK_PRIORITY, &server_task_handle, WEBSERVER_TASK_CORE);
+    if (created == pdPASS) {
+      Serial.printf("HTTP server task running on core %d\n",
+                    WEBSERVER_TASK_CORE);
+    } else {
+      server_task_handle = nullptr;
+      Serial.println(
+          "WARNING: Failed to create server task, falling back to loop()");
+    }
+  }
+#endif
+
   return true;
 }
 
 void WebServerManager::stop() {
+  // Signal the dedicated task to exit; it clears server_task_handle itself
+  // just before deleting itself
+  server_running = false;
+  unsigned long stop_start = millis();
+  while (server_task_handle && (millis() - stop_start) < 2000) {
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  if (server_task_handle) {
+    // Task is stuck servicing a long request; leave it to exit on its own.
+    // begin() will not spawn a replacement until the handle clears.
+    Serial.println("WARNING: Server task still busy during stop()");
+  }
+
   if (server) {
     server->stop();
     delete server;
     server = nullptr;
   }
-  server_running = false;
   Serial.println("HTTP server stopped");
 }
 
@@ -44,49 +198,309 @@ void WebServerManager::handleClients() {
     return;
   }
 
-  WiFiClient client = server->available();
-  if (client) {
-    handleClient(client);
+  // Accept new connections while free slots remain; a full table leaves
+  // connections in the accept backlog instead of dropping them
+  while (true) {
+    int free_index = -1;
+    for (int i = 0; i < MAX_CLIENT_SLOTS; i++) {
+      if (!client_slots[i].in_use) {
+        free_index = i;
+        break;
+      }
+    }
+    if (free_index < 0) {
+      break;
+    }
+
+    WiFiClient incoming = server->available();
+    if (!incoming) {
+      break;
+    }
+
+    ClientSlot &slot = client_slots[free_index];
+    slot.request = &request_pool[free_index]; // Pre-reserved, never freed
+    slot.client = incoming;
+    // Responses are batched into full segments ourselves; Nagle only adds
+    // delayed-ACK stalls on top
+    slot.client.setNoDelay(true);
+    slot.in_use = true;
+    slot.last_activity = millis();
+    slot.pending_len = 0; // Survives resetSlotParse between keep-alive requests
+    slot.wait_kind = WAIT_NONE;
+    resetSlotParse(slot);
   }
+
+  // Pump every in-flight connection one non-blocking step, so header
+  // parsing for one client interleaves with body upload from another
+  for (int i = 0; i < MAX_CLIENT_SLOTS; i++) {
+    ClientSlot &slot = client_slots[i];
+    if (!slot.in_use) {
+      continue;
+    }
+
+    if (!slot.client.connected()) {
+      closeSlot(slot);
+      continue;
+    }
+
+    // Parked long-poll slots are completed from here, not by pumping more
+    // request bytes
+    if (slot.wait_kind != WAIT_NONE) {
+      serviceWaitingSlot(slot);
+      continue;
+    }
+
+    ParseResult result = pumpParse(slot);
+
+    if (result == PARSE_COMPLETE) {
+      if (slot.request_start != 0) {
+        metricsManager.recordLatency(METRIC_HTTP_PARSE,
+                                     millis() - slot.request_start);
+      }
+      if (dispatchRequest(slot)) {
+        if (slot.wait_kind == WAIT_NONE) {
+          // Keep-alive: reuse the warm connection for the next request
+          resetSlotParse(slot);
+          slot.last_activity = millis();
+        }
+        // A parked slot keeps its state until serviceWaitingSlot() fires
+      } else {
+        closeSlot(slot);
+      }
+    } else if (result == PARSE_ERROR) {
+      logManager.println("Failed to parse HTTP request");
+      error_requests++;
+      closeSlot(slot);
+    } else if (millis() - slot.last_activity > CLIENT_SLOT_TIMEOUT_MS) {
+      logManager.println("HTTP client timed out");
+      error_requests++;
+      closeSlot(slot);
+    } else if (slot.request_start != 0 &&
+               millis() - slot.request_start > CLIENT_PARSE_DEADLINE_MS) {
+      // A trickling client cannot hold a slot by drip-feeding bytes
+      logManager.println("HTTP request parse deadline exceeded");
+      error_requests++;
+      closeSlot(slot);
+    }
+  }
+}
+
+void WebServerManager::resetSlotParse(ClientSlot &slot) {
+  HttpRequest *request = slot.request;
+  request->type = REQ_UNKNOWN;
+  request->has_content_length = false;
+  request->content_length = 0;
+  request->is_http11 = false;
+  memset(request->path, 0, sizeof(request->path));
+  memset(request->query_params, 0, sizeof(request->query_params));
+  memset(request->headers, 0, sizeof(request->headers));
+  memset(request->body, 0, sizeof(request->body));
+
+  slot.line[0] = '\0';
+  slot.line_pos = 0;
+  slot.headers_len = 0;
+  slot.body_len = 0;
+  slot.headers_complete = false;
+  slot.request_start = 0;
+}
+
+void WebServerManager::closeSlot(ClientSlot &slot) {
+  slot.client.stop();
+  slot.request = nullptr; // Slab stays in the pool for the next connection
+  slot.in_use = false;
+}
+
+/**
+ * Coarse hash of the status fields worth waking a /status/wait client for:
+ * RSSI bucket, heap bucket, flash state, connectivity and capture failures.
+ * Total captures are deliberately excluded - the continuous-capture ring
+ * ticks them several times a second, which would make every wait fire
+ * immediately.
+ */
+uint32_t WebServerManager::computeStatusFingerprint() {
+  bool connected = WiFi.status() == WL_CONNECTED;
+  FlashStatus flash_status = flashManager.getStatus();
+
+  uint32_t fp = connected ? 1 : 0;
+  fp = fp * 31 + (uint32_t)(connected ? WiFi.RSSI() / 5 : -100);
+  fp = fp * 31 + esp_get_free_heap_size() / 10240;
+  fp = fp * 31 + flash_status.duty_cycle;
+  fp = fp * 31 + cameraManager.getFailedCaptureCount();
+  fp = fp * 31 + (cameraManager.isReady() ? 1 : 0);
+  return fp;
 }
 
-void WebServerManager::handleClient(WiFiClient &client) {
-  if (!client.connected()) {
+/**
+ * Complete a parked long-poll slot once its event fires or the long-poll
+ * deadline lapses
+ */
+void WebServerManager::serviceWaitingSlot(ClientSlot &slot) {
+  // Streams are pumped, not completed - no long-poll deadline applies
+  if (slot.wait_kind == WAIT_STREAM) {
+    serviceStreamSlot(slot);
     return;
   }
 
-  // Reset watchdog for each client request
+  bool fired = false;
+
+  switch (slot.wait_kind) {
+    case WAIT_MOTION:
+      fired = motionManager.getMotionEventCount() != slot.wait_baseline;
+      break;
+    case WAIT_STATUS:
+      fired = computeStatusFingerprint() != slot.wait_baseline;
+      break;
+    default:
+      break;
+  }
+
+  bool timed_out = millis() - slot.wait_start > LONGPOLL_TIMEOUT_MS;
+  if (!fired && !timed_out) {
+    return; // Keep waiting
+  }
+
+  uint8_t kind = slot.wait_kind;
+  slot.wait_kind = WAIT_NONE;
+
+  if (kind == WAIT_STATUS) {
+    // Full status document; the client only receives it because something
+    // in it changed (or the poll expired), so steady-state traffic is gone
+    invalidateStatusCache();
+    handleStatus(slot.client, slot.wait_keep_alive);
+  } else {
+    JsonDocument doc;
+    doc["motion"] = fired;
+    doc["score"] = motionManager.getLastScore();
+    doc["events"] = motionManager.getMotionEventCount();
+    sendJsonResponse(slot.client, doc, 200, slot.wait_keep_alive);
+  }
+
+  if (slot.wait_keep_alive && slot.client.connected()) {
+    resetSlotParse(slot);
+    slot.last_activity = millis();
+  } else {
+    closeSlot(slot);
+  }
+}
+
+/**
+ * A fully-parsed request is ready on this slot - route and answer it.
+ * Returns true when the connection should stay open for the next request.
+ */
+bool WebServerManager::dispatchRequest(ClientSlot &slot) {
+  HttpRequest &request = *slot.request;
+  WiFiClient &client = slot.client;
+
+  // Reset watchdog for each request
   esp_task_wdt_reset();
 
   total_requests++;
   last_request_time = millis();
 
-  // Allocate request on heap to avoid stack overflow
-  HttpRequest *request = (HttpRequest *)malloc(sizeof(HttpRequest));
-  if (!request) {
-    Serial.println("Failed to allocate memory for HTTP request");
-    error_requests++;
-    client.stop();
-    return;
+  logRequest(request);
+
+  // Honor keep-alive so sequential API calls reuse the warm TCP connection
+  // (and its congestion window) instead of paying a handshake each time.
+  // HTTP/1.1 clients default to persistent connections and mostly omit the
+  // header, so absent an explicit Connection value the version decides.
+  char connection_header[32];
+  extractHttpHeader(request.headers, "Connection", connection_header,
+                    sizeof(connection_header));
+  bool keep_alive;
+  if (strcasecmp(connection_header, "keep-alive") == 0) {
+    keep_alive = true;
+  } else if (strcasecmp(connection_header, "close") == 0) {
+    keep_alive = false;
+  } else {
+    keep_alive = request.is_http11;
   }
 
-  if (!parseHttpRequest(client, *request)) {
-    Serial.println("Failed to parse HTTP request");
-    error_requests++;
-    client.stop();
-    free(request);
-    return;
+  // Fast-path rejection when a bucket is empty or the heap is too low for
+  // capture work - overload degrades to 503s instead of a reboot cycle
+  if (!admitRequest(request, client, keep_alive)) {
+    return keep_alive && client.connected();
   }
 
-  logRequest(*request);
+  // Streaming endpoints write directly to the socket and never produce an
+  // ApiResponse, so they are dispatched before the normal request pipeline.
+  // /stream parks its slot and is advanced one frame per handleClients()
+  // pass by serviceStreamSlot(), so other clients keep being serviced.
+  if (request.type == REQ_GET && strcmp(request.path, "/stream") == 0) {
+    if (!cameraManager.isReady()) {
+      client.print("HTTP/1.1 503 Service Unavailable\r\n"
+                   "Content-Type: text/plain\r\n"
+                   "Connection: close\r\n\r\n"
+                   "Camera not ready");
+      return false;
+    }
+
+    logManager.println("MJPEG stream started");
+    client.print("HTTP/1.1 200 OK\r\n"
+                 "Content-Type: multipart/x-mixed-replace; boundary=frame\r\n"
+                 "Access-Control-Allow-Origin: *\r\n"
+                 "Connection: close\r\n\r\n");
+
+    slot.wait_kind = WAIT_STREAM;
+    slot.wait_start = 0;    // Emit the first frame on the next pass
+    slot.wait_baseline = 0; // Frames sent so far
+    slot.wait_keep_alive = false;
+    return true;
+  }
+  if (request.type == REQ_GET && strcmp(request.path, "/snap") == 0) {
+    handleSnap(client, request);
+    return false;
+  }
+  if (request.type == REQ_GET && strcmp(request.path, "/burst") == 0) {
+    handleBurst(client, request);
+    return false;
+  }
+  if (request.type == REQ_GET && strcmp(request.path, "/recordings") == 0) {
+    handleRecordings(client, request, keep_alive);
+    return false;
+  }
+  if (request.type == REQ_GET && strcmp(request.path, "/status") == 0) {
+    handleStatus(client, keep_alive);
+    return keep_alive && client.connected();
+  }
+  if (request.type == REQ_GET && strcmp(request.path, "/metrics") == 0) {
+    handleMetrics(client, keep_alive);
+    return keep_alive && client.connected();
+  }
+  if (request.type == REQ_GET && strcmp(request.path, "/logs") == 0) {
+    handleLogs(client, keep_alive);
+    return keep_alive && client.connected();
+  }
+  if (request.type == REQ_GET && strcmp(request.path, "/benchmark") == 0) {
+    handleBenchmark(client, keep_alive);
+    return keep_alive && client.connected();
+  }
+  if (request.type == REQ_GET && strcmp(request.path, "/status/wait") == 0) {
+    // Push channel: park until the status fingerprint changes, so an
+    // 8-camera dashboard stops paying a poll per camera per second
+    slot.wait_kind = WAIT_STATUS;
+    slot.wait_start = millis();
+    slot.wait_baseline = computeStatusFingerprint();
+    slot.wait_keep_alive = keep_alive;
+    return true;
+  }
+  if (request.type == REQ_GET && strcmp(request.path, "/motion/wait") == 0) {
+    // Park the slot; serviceWaitingSlot() answers when motion fires or the
+    // long-poll deadline lapses. Other slots keep being serviced meanwhile.
+    slot.wait_kind = WAIT_MOTION;
+    slot.wait_start = millis();
+    slot.wait_baseline = motionManager.getMotionEventCount();
+    slot.wait_keep_alive = keep_alive;
+    return true;
+  }
 
-  // Process request and generate response
-  ApiResponse response = processRequest(*request);
+  // Process request into the pooled response slab - no stack or heap copies
+  ApiResponse &response = *response_slab;
+  processRequest(request, response);
 
   logResponse(response);
 
   // Send response
-  sendResponse(client, response);
+  sendResponse(client, response, keep_alive);
 
   if (response.frame_buffer) {
     cameraManager.releaseFrameBuffer(response.frame_buffer);
@@ -94,115 +508,168 @@ void WebServerManager::handleClient(WiFiClient &client) {
     free(response.binary_data);
   }
 
-  free(request);
-  client.stop();
+  return keep_alive && client.connected();
 }
 
-bool WebServerManager::parseHttpRequest(WiFiClient &client,
-                                        HttpRequest &request) {
-  // Reset watchdog during HTTP parsing
-  esp_task_wdt_reset();
+/**
+ * Advance one connection's parse state with whatever bytes are available.
+ * Never blocks: consumes at most a few chunks per call, so a stalled client
+ * only costs one available() check per pass while the other slots progress.
+ */
+ParseResult WebServerManager::pumpParse(ClientSlot &slot) {
+  HttpRequest &request = *slot.request;
+  char chunk[HTTP_BUFFER_SIZE];
+
+  for (int pass = 0; pass < 4; pass++) {
+    if (slot.headers_complete) {
+      // Body phase
+      if (request.type == REQ_UNKNOWN) {
+        return PARSE_ERROR;
+      }
 
-  char current_line[HTTP_BUFFER_SIZE] = {0};
-  int line_pos = 0;
-  bool headers_complete = false;
-  int content_length = 0;
+      size_t want = 0;
+      if (request.type == REQ_POST && request.has_content_length &&
+          request.content_length > 0) {
+        want = (size_t)request.content_length;
+        if (want > sizeof(request.body) - 1) {
+          want = sizeof(request.body) - 1;
+        }
+      }
 
-  request.type = REQ_UNKNOWN;
-  request.has_content_length = false;
-  request.content_length = 0;
+      if (slot.body_len >= want) {
+        request.body[slot.body_len] = '\0';
+        return PARSE_COMPLETE;
+      }
 
-  // Initialize char arrays
-  memset(request.path, 0, sizeof(request.path));
-  memset(request.query_params, 0, sizeof(request.query_params));
-  memset(request.headers, 0, sizeof(request.headers));
-  memset(request.body, 0, sizeof(request.body));
+      int available = slot.client.available();
+      if (available <= 0) {
+        return PARSE_INCOMPLETE;
+      }
 
-  // Parse headers
-  unsigned long parse_start = millis();
-  const unsigned long parse_timeout = 5000; // 5 second timeout for header parsing
+      size_t remaining = want - slot.body_len;
+      size_t to_read = (size_t)available < remaining ? available : remaining;
+      int n = slot.client.read((uint8_t *)request.body + slot.body_len, to_read);
+      if (n > 0) {
+        slot.body_len += n;
+        slot.last_activity = millis();
+      }
+      continue;
+    }
 
-  while (client.connected() && !headers_complete) {
-    if ((millis() - parse_start) > parse_timeout) {
-      Serial.println("HTTP header parsing timeout");
-      return false;
+    // Header phase - replay any pushed-back pipelined bytes first, then
+    // bulk reads: one client.read() per socket chunk instead of one lwIP
+    // round trip per byte
+    int n;
+    if (slot.pending_len > 0) {
+      n = slot.pending_len; // pending never exceeds one chunk
+      memcpy(chunk, slot.pending, n);
+      slot.pending_len = 0;
+    } else {
+      int available = slot.client.available();
+      if (available <= 0) {
+        return PARSE_INCOMPLETE;
+      }
+
+      int to_read = available < (int)sizeof(chunk) ? available : sizeof(chunk);
+      n = slot.client.read((uint8_t *)chunk, to_read);
+      if (n <= 0) {
+        return PARSE_INCOMPLETE;
+      }
+    }
+    slot.last_activity = millis();
+    if (slot.request_start == 0) {
+      slot.request_start = millis();
     }
 
-    if (client.available()) {
-      char c = client.read();
+    for (int i = 0; i < n; i++) {
+      char c = chunk[i];
 
       if (c == '\n') {
-        current_line[line_pos] = '\0';
-        if (line_pos == 0) {
-          headers_complete = true;
-        } else {
-          // Process header line
-          if (strncmp(current_line, "GET ", 4) == 0) {
-            request.type = REQ_GET;
-            char *space_pos = strchr(current_line + 4, ' ');
-            if (space_pos) {
-              *space_pos = '\0';
-              char *full_path = current_line + 4;
-              char *question_mark = strchr(full_path, '?');
-              if (question_mark) {
-                *question_mark = '\0';
-                strncpy(request.path, full_path, sizeof(request.path) - 1);
-                strncpy(request.query_params, question_mark + 1,
-                        sizeof(request.query_params) - 1);
-              } else {
-                strncpy(request.path, full_path, sizeof(request.path) - 1);
-                request.query_params[0] = '\0';
+        slot.line[slot.line_pos] = '\0';
+        if (slot.line_pos == 0) {
+          slot.headers_complete = true;
+          // Bytes remaining in this chunk are the start of the body; any
+          // surplus past the declared body is a pipelined next request and
+          // goes to the pushback buffer
+          if (i + 1 < n) {
+            size_t leftover = n - (i + 1);
+
+            size_t want = 0;
+            if (request.type == REQ_POST && request.has_content_length &&
+                request.content_length > 0) {
+              want = (size_t)request.content_length;
+              if (want > sizeof(request.body) - 1) {
+                want = sizeof(request.body) - 1;
               }
             }
-          } else if (strncmp(current_line, "POST ", 5) == 0) {
-            request.type = REQ_POST;
-            char *space_pos = strchr(current_line + 5, ' ');
-            if (space_pos) {
-              *space_pos = '\0';
-              strncpy(request.path, current_line + 5, sizeof(request.path) - 1);
+
+            size_t body_take = leftover < want ? leftover : want;
+            if (body_take > 0) {
+              memcpy(request.body, chunk + i + 1, body_take);
+              slot.body_len = body_take;
+            }
+
+            size_t extra = leftover - body_take;
+            if (extra > 0) {
+              if (extra > sizeof(slot.pending)) {
+                extra = sizeof(slot.pending);
+              }
+              memcpy(slot.pending, chunk + i + 1 + body_take, extra);
+              slot.pending_len = extra;
             }
-          } else if (strncmp(current_line, "Content-Length: ", 16) == 0) {
-            content_length = atoi(current_line + 16);
-            request.has_content_length = true;
-            request.content_length = content_length;
           }
+          break;
+        }
 
-          // Append to headers
-          strncat(request.headers, current_line,
-                  sizeof(request.headers) - strlen(request.headers) - 1);
-          strncat(request.headers, "\n",
-                  sizeof(request.headers) - strlen(request.headers) - 1);
-          line_pos = 0;
+        // Process header line
+        if (strncmp(slot.line, "GET ", 4) == 0) {
+          request.type = REQ_GET;
+          char *space_pos = strchr(slot.line + 4, ' ');
+          if (space_pos) {
+            *space_pos = '\0';
+            request.is_http11 = strncmp(space_pos + 1, "HTTP/1.1", 8) == 0;
+            char *full_path = slot.line + 4;
+            char *question_mark = strchr(full_path, '?');
+            if (question_mark) {
+              *question_mark = '\0';
+              strncpy(request.path, full_path, sizeof(request.path) - 1);
+              strncpy(request.query_params, question_mark + 1,
+                      sizeof(request.query_params) - 1);
+            } else {
+              strncpy(request.path, full_path, sizeof(request.path) - 1);
+              request.query_params[0] = '\0';
+            }
+          }
+        } else if (strncmp(slot.line, "POST ", 5) == 0) {
+          request.type = REQ_POST;
+          char *space_pos = strchr(slot.line + 5, ' ');
+          if (space_pos) {
+            *space_pos = '\0';
+            request.is_http11 = strncmp(space_pos + 1, "HTTP/1.1", 8) == 0;
+            strncpy(request.path, slot.line + 5, sizeof(request.path) - 1);
+          }
+        } else if (strncmp(slot.line, "Content-Length: ", 16) == 0) {
+          request.has_content_length = true;
+          request.content_length = atoi(slot.line + 16);
         }
-      } else if (c != '\r' && line_pos < sizeof(current_line) - 1) {
-        current_line[line_pos++] = c;
-      }
-    } else {
-      delay(1); // Avoid busy-looping when no data available
-    }
-  }
 
-  // Read POST body if present
-  if (request.type == REQ_POST && request.has_content_length &&
-      content_length > 0) {
-    int bytes_read = 0;
-    unsigned long start_time = millis();
-    const unsigned long timeout_duration = 5000; // 5 second timeout
-
-    while (bytes_read < content_length &&
-           (millis() - start_time) <
-               timeout_duration && // Overflow-safe comparison
-           client.connected() &&
-           bytes_read < sizeof(request.body) - 1) {
-      if (client.available()) {
-        request.body[bytes_read] = (char)client.read();
-        bytes_read++;
+        // Append to headers through the write cursor (no rescan of the
+        // accumulated buffer)
+        size_t line_len = slot.line_pos;
+        if (slot.headers_len + line_len + 2 < sizeof(request.headers)) {
+          memcpy(request.headers + slot.headers_len, slot.line, line_len);
+          slot.headers_len += line_len;
+          request.headers[slot.headers_len++] = '\n';
+          request.headers[slot.headers_len] = '\0';
+        }
+        slot.line_pos = 0;
+      } else if (c != '\r' && slot.line_pos < sizeof(slot.line) - 1) {
+        slot.line[slot.line_pos++] = c;
       }
     }
-    request.body[bytes_read] = '\0';
   }
 
-  return request.type != REQ_UNKNOWN;
+  return PARSE_INCOMPLETE;
 }
 
 /**
@@ -270,101 +737,512 @@ void WebServerManager::extractHttpHeader(const char *headers,
   }
 }
 
-ApiResponse WebServerManager::processRequest(const HttpRequest &request) {
+void WebServerManager::processRequest(const HttpRequest &request,
+                                      ApiResponse &response) {
+  response.reset();
+
   // Route to appropriate handler - Only essential endpoints
   if (strcmp(request.path, "/") == 0) {
-    return handleRoot();
-  } else if (strcmp(request.path, "/status") == 0) {
-    return handleStatus();
+    handleRoot(response);
   } else if (strcmp(request.path, "/snapshot") == 0) {
-    return handleSnapshot(request);
+    handleSnapshot(request, response);
   } else if (strcmp(request.path, "/wifi") == 0) {
-    return handleWiFiConfig(request);
+    handleWiFiConfig(request, response);
   } else {
-    return handle404();
+    handle404(response);
   }
 }
 
-void WebServerManager::sendResponse(WiFiClient &client,
-                                    const ApiResponse &response) {
-  // Send status line
-  client.printf("HTTP/1.1 %d %s\r\n", response.status_code,
-                response.status_code == 200   ? "OK"
-                : response.status_code == 404 ? "Not Found"
-                                              : "Error");
+/**
+ * Write a response body in MTU-sized slices with backpressure: each slice
+ * is bounded by what lwIP can buffer right now, the watchdog is fed
+ * between slices, and a peer that stops draining for
+ * SEND_STALL_DEADLINE_MS aborts the transfer cleanly. Returns bytes
+ * actually written - callers release their frame buffer immediately after,
+ * stalled or not.
+ */
+size_t WebServerManager::writeBody(WiFiClient &client, const uint8_t *data,
+                                   size_t len) {
+  size_t sent = 0;
+  unsigned long start = millis();
+  unsigned long last_progress = start;
+
+  // Absolute per-transfer budget scaled to a minimum drain rate: the
+  // no-progress deadline alone resets on every trickled byte and would let
+  // a slow client hold the transfer (and the frame buffer) forever
+  unsigned long max_duration_ms =
+      SEND_STALL_DEADLINE_MS + len / SEND_MIN_RATE_BYTES_PER_MS;
+
+  while (sent < len && client.connected()) {
+    esp_task_wdt_reset();
+
+    if (millis() - start > max_duration_ms) {
+      logManager.printf("Send below minimum rate, aborting transfer (%u/%u)\n",
+                        sent, len);
+      break;
+    }
 
-  // Send headers
-  client.printf("Content-Type: %s\r\n", response.content_type);
+    // Backpressure: never hand lwIP more than its send buffer can take,
+    // so write() returns quickly instead of blocking until the peer drains
+    int window = client.availableForWrite();
+    if (window <= 0) {
+      if (millis() - last_progress > SEND_STALL_DEADLINE_MS) {
+        logManager.printf("Send stalled for %d ms, aborting transfer (%u/%u)\n",
+                          SEND_STALL_DEADLINE_MS, sent, len);
+        break;
+      }
+      delay(1);
+      continue;
+    }
 
-  if (response.is_binary && response.binary_data) {
-    client.printf("Content-Length: %u\r\n", response.content_length);
+    size_t slice = len - sent;
+    if (slice > TCP_WRITE_CHUNK_SIZE) {
+      slice = TCP_WRITE_CHUNK_SIZE;
+    }
+    if (slice > (size_t)window) {
+      slice = window;
+    }
+
+    size_t written = client.write(data + sent, slice);
+    if (written == 0) {
+      break; // Socket error or peer gone
+    }
+    sent += written;
+    last_progress = millis();
+  }
+  return sent;
+}
+
+void WebServerManager::sendResponse(WiFiClient &client,
+                                    const ApiResponse &response,
+                                    bool keep_alive) {
+  unsigned long write_start = millis();
+
+  size_t body_length = (response.is_binary && response.binary_data)
+                           ? response.content_length
+                           : strlen(response.body);
+
+  // Assemble the whole header block into one buffer and push it with a
+  // single write() - one TCP segment instead of a flurry of tiny packets
+  // fighting Nagle and delayed ACKs before the first body byte
+  char headers[RESPONSE_HEADER_BUFFER_SIZE];
+  int header_len = snprintf(
+      headers, sizeof(headers),
+      "HTTP/1.1 %d %s\r\n"
+      "Content-Type: %s\r\n"
+      "Content-Length: %u\r\n"
+      "%s%s"
+      "Access-Control-Allow-Origin: *\r\n",
+      response.status_code,
+      response.status_code == 200   ? "OK"
+      : response.status_code == 404 ? "Not Found"
+                                    : "Error",
+      response.content_type, body_length,
+      response.is_gzip ? "Content-Encoding: gzip\r\n" : "",
+      response.extra_headers);
+
+  if (keep_alive) {
+    header_len += snprintf(headers + header_len,
+                           sizeof(headers) - header_len,
+                           "Connection: keep-alive\r\n"
+                           "Keep-Alive: timeout=%d\r\n\r\n",
+                           CLIENT_SLOT_TIMEOUT_MS / 1000);
   } else {
-    client.printf("Content-Length: %u\r\n", strlen(response.body));
+    header_len += snprintf(headers + header_len,
+                           sizeof(headers) - header_len,
+                           "Connection: close\r\n\r\n");
   }
 
-  // CORS headers
-  client.println("Access-Control-Allow-Origin: *");
-  client.println("Connection: close");
-  client.println();
+  client.write((const uint8_t *)headers, header_len);
 
   // Send body
+  size_t body_sent = body_length;
   if (response.is_binary && response.binary_data) {
-    client.write(response.binary_data, response.content_length);
-  } else {
-    client.print(response.body);
+    body_sent = writeBody(client, response.binary_data, body_length);
+  } else if (body_length > 0) {
+    body_sent = writeBody(client, (const uint8_t *)response.body, body_length);
+  }
+
+  // A truncated body must not leave a keep-alive connection desynced
+  if (body_sent != body_length) {
+    client.stop();
   }
+
+  metricsManager.recordLatency(METRIC_SOCKET_WRITE, millis() - write_start);
 }
 
 // API Endpoints
-ApiResponse WebServerManager::handleRoot() {
-  ApiResponse response;
+void WebServerManager::handleRoot(ApiResponse &response) {
+  // The web UI is a gzip asset generated at build time by
+  // tools/gen_webpage.py and served straight from flash - no per-request
+  // allocation, ~10 KB on the wire instead of 65 KB. The page discovers
+  // device name and IP itself via /status, so nothing needs patching.
   response.status_code = 200;
   strncpy(response.content_type, "text/html",
           sizeof(response.content_type) - 1);
   response.content_type[sizeof(response.content_type) - 1] = '\0';
 
-  // Allocate HTML buffer on heap to avoid stack overflow
-  char *html_buffer = (char *)malloc(HTML_BUFFER_SIZE);
-  if (!html_buffer) {
-    strcpy(response.body, "<html><body><h1>500 Error</h1><p>Memory allocation failed</p></body></html>");
-    response.status_code = 500;
-    response.is_binary = false;
-    response.binary_data = nullptr;
-    response.content_length = strlen(response.body);
-    return response;
+  response.is_binary = true;
+  response.is_gzip = true;
+  response.binary_data = (uint8_t *)WEBPAGE_HTML_GZ;
+  response.owns_binary_data = false;
+  response.content_length = WEBPAGE_HTML_GZ_LEN;
+  response.body[0] = '\0'; // Clear body since we're using binary_data
+}
+
+/**
+ * MJPEG stream advancement: one multipart frame per handleClients() pass,
+ * so a stream never head-of-line-blocks the other slots the way the old
+ * inline run-to-disconnect loop did. wait_start paces frames, wait_baseline
+ * counts frames sent.
+ */
+void WebServerManager::serviceStreamSlot(ClientSlot &slot) {
+  unsigned long now = millis();
+  if (now - slot.wait_start < STREAM_FRAME_INTERVAL_MS) {
+    return; // Pace the sensor; other slots get serviced meanwhile
   }
+  slot.wait_start = now;
 
-  generateWebPage(html_buffer, HTML_BUFFER_SIZE);
+  camera_fb_t *fb = cameraManager.captureFrame();
+  if (!fb) {
+    return; // Sensor busy or transient failure - retry next pass
+  }
 
-  // Use binary_data pointer to avoid copying large buffer
-  response.is_binary = true;
-  response.binary_data = (uint8_t *)html_buffer;
-  response.owns_binary_data = true;
-  response.content_length = strlen(html_buffer);
-  response.body[0] = '\0';  // Clear body since we're using binary_data
+  size_t frame_len = fb->len;
+  slot.client.printf("--frame\r\n"
+                     "Content-Type: image/jpeg\r\n"
+                     "Content-Length: %u\r\n\r\n",
+                     frame_len);
+  size_t written = writeBody(slot.client, fb->buf, frame_len);
+  slot.client.print("\r\n");
+
+  cameraManager.releaseFrameBuffer(fb);
+
+  if (written != frame_len) {
+    // Client went away (or stalled past the send deadline)
+    logManager.printf("MJPEG stream ended after %u frames\n",
+                      slot.wait_baseline);
+    closeSlot(slot);
+    return;
+  }
+  slot.wait_baseline++;
+}
+
+/**
+ * Fast snapshot endpoint (GET /snap, GET /snap?thumb=1)
+ * Serves the newest frame from the continuous-capture ring without touching
+ * sensor settings, so latency is pure socket-write time. Falls back to a
+ * live capture when the ring is empty (continuous capture off or warming
+ * up). With thumb=1 the frame is decode-downscaled to a ~5 KB preview for
+ * dashboard tiles instead of shipping the full JPEG.
+ */
+void WebServerManager::handleSnap(WiFiClient &client,
+                                  const HttpRequest &request) {
+  char thumb_param[4];
+  extractQueryParam(request.query_params, "thumb", thumb_param,
+                    sizeof(thumb_param));
+  bool want_thumb = strcmp(thumb_param, "1") == 0;
+
+  // ?quality= requests a per-client encode level; ring frames carry the
+  // configured quality, so an override forces a live capture
+  char quality_param[8];
+  extractQueryParam(request.query_params, "quality", quality_param,
+                    sizeof(quality_param));
+  bool quality_override = false;
+  if (strlen(quality_param) > 0) {
+    uint8_t requested = constrain(atoi(quality_param), 0, 63);
+    quality_override = cameraManager.beginQualityOverride(requested);
+  }
+
+  uint8_t *buf = nullptr;
+  size_t len = 0;
+  unsigned long timestamp = 0;
+
+  int ring_index = -1;
+  camera_fb_t *fb = nullptr;
+
+  if (!quality_override) {
+    ring_index = cameraManager.acquireLatestFrame(&buf, &len, &timestamp);
+  }
+
+  if (ring_index < 0) {
+    // Ring not ready (or a quality override demands a fresh encode) -
+    // capture directly as /snapshot would
+    fb = cameraManager.captureFrame();
+    if (!fb) {
+      if (quality_override) {
+        cameraManager.endQualityOverride();
+      }
+      client.print("HTTP/1.1 503 Service Unavailable\r\n"
+                   "Content-Type: text/plain\r\n"
+                   "Connection: close\r\n\r\n"
+                   "No frame available");
+      return;
+    }
+    buf = fb->buf;
+    len = fb->len;
+    timestamp = millis();
+  }
+
+  // The OV2640 encodes in-sensor, so the frame is final the moment
+  // captureFrame() returns - restore the quality now, before the socket
+  // write, or the continuous-capture ring fills with override-quality
+  // frames for the whole transfer to a slow client
+  if (quality_override) {
+    cameraManager.endQualityOverride();
+    quality_override = false;
+  }
+
+  // Thumbnail: re-encode before sending, then release the source frame.
+  // Falls back to the full frame when the downscale pipeline can't run.
+  uint8_t *thumb_buf = nullptr;
+  size_t thumb_len = 0;
+  if (want_thumb &&
+      cameraManager.makeThumbnail(buf, len, &thumb_buf, &thumb_len)) {
+    buf = thumb_buf;
+    len = thumb_len;
+  }
 
-  return response;
+  client.printf("HTTP/1.1 200 OK\r\n"
+                "Content-Type: image/jpeg\r\n"
+                "Content-Length: %u\r\n"
+                "X-Frame-Age-Ms: %lu\r\n"
+                "Access-Control-Allow-Origin: *\r\n"
+                "Connection: close\r\n\r\n",
+                len, millis() - timestamp);
+  writeBody(client, buf, len);
+
+  if (thumb_buf) {
+    free(thumb_buf);
+  }
+  if (ring_index >= 0) {
+    cameraManager.releaseRingFrame(ring_index);
+  } else {
+    cameraManager.releaseFrameBuffer(fb);
+  }
 }
 
-ApiResponse WebServerManager::handleStatus() {
-  ApiResponse response;
-  response.status_code = 200;
-  strncpy(response.content_type, "application/json",
-          sizeof(response.content_type) - 1);
-  response.content_type[sizeof(response.content_type) - 1] = '\0';
-  response.is_binary = false;
+/**
+ * Burst capture endpoint (GET /burst?n=10)
+ * Configures nothing, then tight-loops captureFrame()/releaseFrameBuffer()
+ * streaming each JPEG as a multipart part on the one socket - the sensor
+ * keeps running at its native rate instead of paying connection setup,
+ * applySettings() and warmup per frame.
+ */
+void WebServerManager::handleBurst(WiFiClient &client,
+                                   const HttpRequest &request) {
+  if (!cameraManager.isReady()) {
+    client.print("HTTP/1.1 503 Service Unavailable\r\n"
+                 "Content-Type: text/plain\r\n"
+                 "Connection: close\r\n\r\n"
+                 "Camera not ready");
+    return;
+  }
 
-  JsonDocument doc;
-  generateStatusJson(doc);
+  int frame_count = BURST_DEFAULT_FRAMES;
+  char n_param[8];
+  extractQueryParam(request.query_params, "n", n_param, sizeof(n_param));
+  if (strlen(n_param) > 0) {
+    frame_count = constrain(atoi(n_param), 1, BURST_MAX_FRAMES);
+  }
 
-  serializeJson(doc, response.body, sizeof(response.body));
+  // Optional per-burst quality override, restored after the last frame
+  char quality_param[8];
+  extractQueryParam(request.query_params, "quality", quality_param,
+                    sizeof(quality_param));
+  bool quality_override = false;
+  if (strlen(quality_param) > 0) {
+    uint8_t requested = constrain(atoi(quality_param), 0, 63);
+    quality_override = cameraManager.beginQualityOverride(requested);
+  }
 
-  return response;
+  logManager.printf("Burst capture: %d frames\n", frame_count);
+
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: multipart/x-mixed-replace; boundary=frame\r\n"
+               "Access-Control-Allow-Origin: *\r\n"
+               "Connection: close\r\n\r\n");
+
+  unsigned long burst_start = millis();
+  int frames_sent = 0;
+
+  for (int i = 0; i < frame_count && client.connected(); i++) {
+    esp_task_wdt_reset();
+
+    camera_fb_t *fb = cameraManager.captureFrame();
+    if (!fb) {
+      // The capture task may hold the lock; one short retry, then give up
+      // on this frame rather than stalling the burst
+      delay(10);
+      fb = cameraManager.captureFrame();
+      if (!fb) {
+        continue;
+      }
+    }
+
+    size_t frame_len = fb->len;
+    client.printf("--frame\r\n"
+                  "Content-Type: image/jpeg\r\n"
+                  "Content-Length: %u\r\n"
+                  "X-Frame-Index: %d\r\n\r\n",
+                  frame_len, i);
+    size_t written = writeBody(client, fb->buf, frame_len);
+    client.print("\r\n");
+
+    cameraManager.releaseFrameBuffer(fb);
+
+    if (written != frame_len) {
+      break;
+    }
+    frames_sent++;
+  }
+
+  if (quality_override) {
+    cameraManager.endQualityOverride();
+  }
+
+  unsigned long elapsed = millis() - burst_start;
+  logManager.printf("Burst complete: %d frames in %lu ms (%.1f fps)\n",
+                    frames_sent, elapsed,
+                    elapsed > 0 ? (frames_sent * 1000.0f) / elapsed : 0.0f);
 }
 
-ApiResponse WebServerManager::handleSnapshot(const HttpRequest &request) {
+// Context threaded through RecorderManager::streamRange for /recordings
+struct RecordingSinkCtx {
+  WiFiClient *client;
+  size_t frame_progress;
+};
+
+static bool recordingSink(void *raw_ctx, const FrameIndexEntry &entry,
+                          const uint8_t *chunk, size_t chunk_len,
+                          bool first_chunk) {
+  RecordingSinkCtx *ctx = (RecordingSinkCtx *)raw_ctx;
+  if (!ctx->client->connected()) {
+    return false;
+  }
+
+  if (first_chunk) {
+    ctx->frame_progress = 0;
+    ctx->client->printf("--frame\r\n"
+                        "Content-Type: image/jpeg\r\n"
+                        "Content-Length: %u\r\n"
+                        "X-Timestamp-Ms: %u\r\n\r\n",
+                        entry.length, entry.timestamp);
+  }
+
+  // Same backpressure + stall-deadline path as every other body write; a
+  // peer that stops draining aborts the range instead of holding the
+  // server task (and the spooler's mutex) per chunk
+  if (webServerManager.writeBody(*ctx->client, chunk, chunk_len) !=
+      chunk_len) {
+    return false;
+  }
+
+  ctx->frame_progress += chunk_len;
+  if (ctx->frame_progress >= entry.length) {
+    ctx->client->print("\r\n");
+  }
+  return true;
+}
+
+/**
+ * Recorded history retrieval (GET /recordings, GET /recordings?from=&to=)
+ * Without a range: JSON summary of what the SD spool holds. With a range:
+ * every indexed frame inside [from, to] (millis timestamps) streamed as
+ * multipart parts at SD read speed.
+ */
+void WebServerManager::handleRecordings(WiFiClient &client,
+                                        const HttpRequest &request,
+                                        bool keep_alive) {
+  if (!recorderManager.isActive()) {
+    client.print("HTTP/1.1 503 Service Unavailable\r\n"
+                 "Content-Type: text/plain\r\n"
+                 "Connection: close\r\n\r\n"
+                 "Recorder not active");
+    return;
+  }
+
+  char from_param[16];
+  char to_param[16];
+  extractQueryParam(request.query_params, "from", from_param,
+                    sizeof(from_param));
+  extractQueryParam(request.query_params, "to", to_param, sizeof(to_param));
+
+  if (strlen(from_param) == 0 && strlen(to_param) == 0) {
+    uint32_t oldest = 0;
+    uint32_t newest = 0;
+    int frames = recorderManager.getIndexSummary(&oldest, &newest);
+
+    JsonDocument doc;
+    doc["frames_indexed"] = frames;
+    doc["oldest_ms"] = oldest;
+    doc["newest_ms"] = newest;
+    doc["frames_recorded"] = recorderManager.getFramesRecorded();
+    doc["frames_dropped"] = recorderManager.getFramesDropped();
+    sendJsonResponse(client, doc, 200, keep_alive);
+    return;
+  }
+
+  uint32_t from = strlen(from_param) > 0 ? strtoul(from_param, nullptr, 10) : 0;
+  uint32_t to = strlen(to_param) > 0 ? strtoul(to_param, nullptr, 10)
+                                     : UINT32_MAX;
+
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: multipart/x-mixed-replace; boundary=frame\r\n"
+               "Access-Control-Allow-Origin: *\r\n"
+               "Connection: close\r\n\r\n");
+
+  RecordingSinkCtx ctx = {&client, 0};
+  int delivered = recorderManager.streamRange(from, to, recordingSink, &ctx);
+  logManager.printf("Recordings: delivered %d frames for range [%u, %u]\n",
+                    delivered, from, to);
+}
+
+/**
+ * System status endpoint (GET /status)
+ * Repeat polls within STATUS_CACHE_TTL_MS are served from a prebuilt
+ * serialized buffer; the document is only rebuilt when the TTL lapses or
+ * invalidateStatusCache() fires on a settings/WiFi transition. Oversized
+ * documents fall back to chunked streaming.
+ */
+void WebServerManager::handleStatus(WiFiClient &client, bool keep_alive) {
+  unsigned long now = millis();
+
+  if (status_cache_time == 0 || now - status_cache_time > STATUS_CACHE_TTL_MS) {
+    JsonDocument doc;
+    generateStatusJson(doc);
+
+    size_t needed = measureJson(doc);
+    if (needed >= sizeof(status_cache)) {
+      // Too large to cache - stream it straight onto the socket
+      sendJsonResponse(client, doc, 200, keep_alive);
+      return;
+    }
+
+    serializeJson(doc, status_cache, sizeof(status_cache));
+    status_cache_len = needed;
+    status_cache_time = now;
+  }
+
+  client.printf("HTTP/1.1 200 OK\r\n"
+                "Content-Type: application/json\r\n"
+                "Content-Length: %u\r\n"
+                "Access-Control-Allow-Origin: *\r\n",
+                status_cache_len);
+  if (keep_alive) {
+    client.printf("Connection: keep-alive\r\n"
+                  "Keep-Alive: timeout=%d\r\n",
+                  CLIENT_SLOT_TIMEOUT_MS / 1000);
+  } else {
+    client.print("Connection: close\r\n");
+  }
+  client.print("\r\n");
+  client.write((const uint8_t *)status_cache, status_cache_len);
+}
+
+void WebServerManager::handleSnapshot(const HttpRequest &request,
+                                      ApiResponse &response) {
   // This handles the legacy POST /snapshot endpoint with JSON body
-  ApiResponse response;
   response.is_binary = true;
   strncpy(response.content_type, "image/jpeg",
           sizeof(response.content_type) - 1);
@@ -378,7 +1256,7 @@ ApiResponse WebServerManager::handleSnapshot(const HttpRequest &request) {
     response.content_type[sizeof(response.content_type) - 1] = '\0';
     createErrorResponse("Method not allowed", 405, response.body,
                         sizeof(response.body));
-    return response;
+    return;
   }
 
   // Parse JSON body
@@ -391,7 +1269,7 @@ ApiResponse WebServerManager::handleSnapshot(const HttpRequest &request) {
     response.content_type[sizeof(response.content_type) - 1] = '\0';
     createErrorResponse("Invalid JSON", 400, response.body,
                         sizeof(response.body));
-    return response;
+    return;
   }
 
   // Parse camera settings and flash mode
@@ -405,10 +1283,11 @@ ApiResponse WebServerManager::handleSnapshot(const HttpRequest &request) {
     response.content_type[sizeof(response.content_type) - 1] = '\0';
     createErrorResponse("Invalid camera settings", 400, response.body,
                         sizeof(response.body));
-    return response;
+    return;
   }
 
-  // Apply settings
+  // Apply settings - camera fields in /status may change underneath the cache
+  invalidateStatusCache();
   framesize_t original_resolution = cameraManager.getCurrentResolution();
   if (!cameraManager.applySettings(settings)) {
     response.status_code = 500;
@@ -418,29 +1297,48 @@ ApiResponse WebServerManager::handleSnapshot(const HttpRequest &request) {
     response.content_type[sizeof(response.content_type) - 1] = '\0';
     createErrorResponse("Failed to apply camera settings", 500, response.body,
                         sizeof(response.body));
-    return response;
+    return;
   }
 
-  // Handle flash
+  // Handle flash - duty and settle time are metered from the previous
+  // ambient frame's brightness, so bright scenes skip the stabilization
+  // delay entirely
+  uint8_t flash_duty = FLASH_OFF;
   if (use_flash) {
-    flashManager.setFlashDuty(FLASH_MEDIUM);
-    delay(200); // Stabilization
+    flash_duty = flashManager.meterFlashDuty();
+    flashManager.setFlashDuty(flash_duty);
+    uint16_t settle = flashManager.meterSettleTime(flash_duty);
+    if (settle > 0) {
+      delay(settle);
+    }
   }
 
   // Capture with warm-up frames
   cameraManager.warmupCamera(3);
   camera_fb_t *fb = cameraManager.captureFrame();
 
-  // Turn off flash
+  // Turn off flash; meter only frames the LED did not light, otherwise the
+  // metering loop feeds back on its own output
   if (use_flash) {
     flashManager.setFlashDuty(FLASH_OFF);
   }
+  if (fb && flash_duty == FLASH_OFF) {
+    flashManager.finishCapture(fb);
+  }
 
   if (fb) {
     response.status_code = 200;
     response.content_length = fb->len;
     response.binary_data = fb->buf;
     response.frame_buffer = fb;
+
+    // Report the resolution actually used - the pre-flight budget may have
+    // stepped it down from the request
+    char resolution_str[32];
+    cameraManager.getResolutionString(cameraManager.getCurrentResolution(),
+                                      resolution_str, sizeof(resolution_str));
+    snprintf(response.extra_headers, sizeof(response.extra_headers),
+             "X-Frame-Size: %s\r\n", resolution_str);
   } else {
     response.status_code = 500;
     response.is_binary = false;
@@ -450,12 +1348,10 @@ ApiResponse WebServerManager::handleSnapshot(const HttpRequest &request) {
     createErrorResponse("Camera capture failed", 500, response.body,
                         sizeof(response.body));
   }
-
-  return response;
 }
 
-ApiResponse WebServerManager::handleWiFiConfig(const HttpRequest &request) {
-  ApiResponse response;
+void WebServerManager::handleWiFiConfig(const HttpRequest &request,
+                                        ApiResponse &response) {
   response.status_code = 200;
   strncpy(response.content_type, "application/json", sizeof(response.content_type) - 1);
   response.is_binary = false;
@@ -463,14 +1359,14 @@ ApiResponse WebServerManager::handleWiFiConfig(const HttpRequest &request) {
   if (request.type != REQ_POST) {
     response.status_code = 405;
     createErrorResponse("Method not allowed", 405, response.body, sizeof(response.body));
-    return response;
+    return;
   }
 
   JsonDocument json;
   if (!parseJsonBody(request.body, json)) {
     response.status_code = 400;
     createErrorResponse("Invalid JSON", 400, response.body, sizeof(response.body));
-    return response;
+    return;
   }
 
   bool ssid_changed = false;
@@ -508,15 +1404,15 @@ ApiResponse WebServerManager::handleWiFiConfig(const HttpRequest &request) {
   if (!any_valid) {
     response.status_code = 400;
     createErrorResponse("No valid fields", 400, response.body, sizeof(response.body));
-    return response;
+    return;
   }
 
-  if (!configManager.saveConfig()) {
-    response.status_code = 500;
-    createErrorResponse("Failed to save settings to EEPROM", 500, response.body, sizeof(response.body));
-    return response;
-  }
+  // In-RAM config is already updated; the NVS commit happens from loop()
+  // once no capture is in flight, so this response returns immediately and
+  // the flash write never collides with frame DMA
+  configManager.requestSave();
   wifi_reconnect_requested = true;
+  invalidateStatusCache();
 
   JsonDocument resp;
   resp["status"] = "success";
@@ -525,22 +1421,20 @@ ApiResponse WebServerManager::handleWiFiConfig(const HttpRequest &request) {
   char message[256] = {0};
   if (ssid_changed || password_changed || bandwidth_changed) {
     snprintf(message, sizeof(message),
-             "✓ Settings saved to EEPROM%s%s%s - Device will reconnect in 2 seconds",
+             "✓ Settings saved to NVS%s%s%s - Device will reconnect in 2 seconds",
              ssid_changed ? " (SSID)" : "",
              password_changed ? " (Password)" : "",
              bandwidth_changed ? " (Bandwidth)" : "");
   } else {
-    snprintf(message, sizeof(message), "✓ Settings confirmed and saved to EEPROM - Reconnecting...");
+    snprintf(message, sizeof(message), "✓ Settings confirmed and saved to NVS - Reconnecting...");
   }
 
   resp["message"] = message;
   resp["ssid_changed"] = ssid_changed;
   serializeJson(resp, response.body, sizeof(response.body));
-  return response;
 }
 
-ApiResponse WebServerManager::handle404() {
-  ApiResponse response;
+void WebServerManager::handle404(ApiResponse &response) {
   response.status_code = 404;
   strncpy(response.content_type, "text/plain",
           sizeof(response.content_type) - 1);
@@ -548,11 +1442,225 @@ ApiResponse WebServerManager::handle404() {
   response.is_binary = false;
   strncpy(response.body, "404 Not Found", sizeof(response.body) - 1);
   response.body[sizeof(response.body) - 1] = '\0';
-
-  return response;
 }
 
 // JSON utilities
+
+/**
+ * Print adapter that frames everything written through it as HTTP/1.1
+ * chunked transfer encoding, so ArduinoJson can serialize straight onto
+ * the socket without knowing the total length up front
+ */
+class ChunkedPrint : public Print {
+public:
+  explicit ChunkedPrint(WiFiClient &client) : client(client), fill(0) {}
+
+  size_t write(uint8_t b) override {
+    buffer[fill++] = b;
+    if (fill == sizeof(buffer)) {
+      flushChunk();
+    }
+    return 1;
+  }
+
+  size_t write(const uint8_t *data, size_t len) override {
+    for (size_t i = 0; i < len; i++) {
+      write(data[i]);
+    }
+    return len;
+  }
+
+  // Flush the final chunk and the terminating zero-length chunk
+  void finish() {
+    flushChunk();
+    client.print("0\r\n\r\n");
+  }
+
+private:
+  void flushChunk() {
+    if (fill == 0) {
+      return;
+    }
+    client.printf("%x\r\n", fill);
+    client.write(buffer, fill);
+    client.print("\r\n");
+    fill = 0;
+  }
+
+  WiFiClient &client;
+  uint8_t buffer[512];
+  size_t fill;
+};
+
+/**
+ * Serialize a JSON document directly onto the client socket using chunked
+ * transfer encoding - no intermediate body buffer, no size ceiling
+ */
+void WebServerManager::sendJsonResponse(WiFiClient &client, JsonDocument &doc,
+                                        int status_code, bool keep_alive) {
+  client.printf("HTTP/1.1 %d %s\r\n", status_code,
+                status_code == 200 ? "OK" : "Error");
+  client.print("Content-Type: application/json\r\n"
+               "Transfer-Encoding: chunked\r\n"
+               "Access-Control-Allow-Origin: *\r\n");
+  if (keep_alive) {
+    client.printf("Connection: keep-alive\r\n"
+                  "Keep-Alive: timeout=%d\r\n",
+                  CLIENT_SLOT_TIMEOUT_MS / 1000);
+  } else {
+    client.print("Connection: close\r\n");
+  }
+  client.print("\r\n");
+
+  ChunkedPrint chunked(client);
+  serializeJson(doc, chunked);
+  chunked.finish();
+}
+
+/**
+ * Prometheus metrics endpoint (GET /metrics)
+ * Latency histograms, heap gauges and request/capture counters in text
+ * exposition format for fleet dashboards
+ */
+void WebServerManager::handleMetrics(WiFiClient &client, bool keep_alive) {
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: text/plain; version=0.0.4\r\n"
+               "Transfer-Encoding: chunked\r\n"
+               "Access-Control-Allow-Origin: *\r\n");
+  if (keep_alive) {
+    client.printf("Connection: keep-alive\r\n"
+                  "Keep-Alive: timeout=%d\r\n",
+                  CLIENT_SLOT_TIMEOUT_MS / 1000);
+  } else {
+    client.print("Connection: close\r\n");
+  }
+  client.print("\r\n");
+
+  ChunkedPrint chunked(client);
+  metricsManager.writePrometheus(chunked);
+  chunked.finish();
+}
+
+/**
+ * On-device benchmark suite (GET /benchmark)
+ * Times the hot paths with the device's own clock - N captures per
+ * reachable framesize, a forced full settings apply, and status JSON
+ * builds - and returns a machine-readable report. Runs synchronously for
+ * several seconds; meant for before/after comparison runs, not dashboards.
+ */
+void WebServerManager::handleBenchmark(WiFiClient &client, bool keep_alive) {
+  JsonDocument doc;
+
+  if (!cameraManager.isReady()) {
+    doc["error"] = "camera not ready";
+    sendJsonResponse(client, doc, 503, keep_alive);
+    return;
+  }
+
+  const int frames_per_size = 5;
+  framesize_t original_resolution = cameraManager.getCurrentResolution();
+  const framesize_t sizes[] = {FRAMESIZE_QVGA, FRAMESIZE_VGA, FRAMESIZE_UXGA};
+
+  JsonObject capture = doc["capture"].to<JsonObject>();
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    framesize_t size = sizes[s];
+    if (cameraManager.getSafeFrameSize(size) != size) {
+      continue; // Not reachable on this board (no PSRAM / low heap)
+    }
+    if (!cameraManager.setResolution(size)) {
+      continue;
+    }
+
+    unsigned long min_ms = ULONG_MAX;
+    unsigned long max_ms = 0;
+    unsigned long total_ms = 0;
+    size_t total_bytes = 0;
+    int ok_frames = 0;
+
+    for (int i = 0; i < frames_per_size; i++) {
+      esp_task_wdt_reset();
+      unsigned long t0 = millis();
+      camera_fb_t *fb = cameraManager.captureFrame();
+      unsigned long elapsed = millis() - t0;
+      if (!fb) {
+        continue;
+      }
+      total_bytes += fb->len;
+      cameraManager.releaseFrameBuffer(fb);
+
+      min_ms = elapsed < min_ms ? elapsed : min_ms;
+      max_ms = elapsed > max_ms ? elapsed : max_ms;
+      total_ms += elapsed;
+      ok_frames++;
+    }
+
+    if (ok_frames > 0) {
+      char size_str[32];
+      cameraManager.getResolutionString(size, size_str, sizeof(size_str));
+      JsonObject entry = capture[size_str].to<JsonObject>();
+      entry["frames"] = ok_frames;
+      entry["avg_ms"] = total_ms / ok_frames;
+      entry["min_ms"] = min_ms;
+      entry["max_ms"] = max_ms;
+      entry["avg_bytes"] = total_bytes / ok_frames;
+    }
+  }
+
+  cameraManager.setResolution(original_resolution);
+
+  // Full sensor reconfiguration cost (cache bypassed). Only the settings
+  // actually on the sensor are re-applied - getCurrentSettings() would hand
+  // back defaults and silently clobber whatever the operator tuned.
+  CameraSettings settings;
+  unsigned long t0;
+  if (cameraManager.getLastAppliedSettings(settings)) {
+    t0 = millis();
+    cameraManager.applySettings(settings, true);
+    doc["settings_apply_ms"] = millis() - t0;
+  }
+
+  // Status JSON build-and-serialize cost
+  const int json_iterations = 10;
+  t0 = millis();
+  for (int i = 0; i < json_iterations; i++) {
+    JsonDocument status_doc;
+    generateStatusJson(status_doc);
+    char sink[JSON_BUFFER_SIZE];
+    serializeJson(status_doc, sink, sizeof(sink));
+  }
+  doc["status_json_avg_ms"] =
+      (float)(millis() - t0) / json_iterations;
+
+  doc["free_heap"] = esp_get_free_heap_size();
+  doc["largest_dma_block"] =
+      heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+
+  sendJsonResponse(client, doc, 200, keep_alive);
+}
+
+/**
+ * Remote log access (GET /logs)
+ * Streams the retained deferred-log ring, newest LOG_RING_SIZE bytes
+ */
+void WebServerManager::handleLogs(WiFiClient &client, bool keep_alive) {
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: text/plain\r\n"
+               "Transfer-Encoding: chunked\r\n"
+               "Access-Control-Allow-Origin: *\r\n");
+  if (keep_alive) {
+    client.printf("Connection: keep-alive\r\n"
+                  "Keep-Alive: timeout=%d\r\n",
+                  CLIENT_SLOT_TIMEOUT_MS / 1000);
+  } else {
+    client.print("Connection: close\r\n");
+  }
+  client.print("\r\n");
+
+  ChunkedPrint chunked(client);
+  logManager.writeTo(chunked);
+  chunked.finish();
+}
+
 void WebServerManager::createJsonResponse(const char *status,
                                           JsonDocument &data, char *output,
                                           size_t max_len) {
@@ -579,7 +1687,7 @@ void WebServerManager::createErrorResponse(const char *error, int code,
 bool WebServerManager::parseJsonBody(const char *body, JsonDocument &doc) {
   DeserializationError error = deserializeJson(doc, body);
   if (error) {
-    Serial.printf("JSON parsing failed: %s\n", error.c_str());
+    logManager.printf("JSON parsing failed: %s\n", error.c_str());
     return false;
   }
   return true;
@@ -643,17 +1751,21 @@ bool WebServerManager::parseRequestSettings(const JsonDocument &json,
 
 // Helper methods
 void WebServerManager::logRequest(const HttpRequest &request) {
-  Serial.printf("HTTP %s %s", request.type == REQ_GET ? "GET" : "POST",
-                request.path);
+  // Deferred: a UART write here would stall the request path
   if (strlen(request.query_params) > 0) {
-    Serial.printf("?%s", request.query_params);
+    logManager.printf("HTTP %s %s?%s\n",
+                      request.type == REQ_GET ? "GET" : "POST", request.path,
+                      request.query_params);
+  } else {
+    logManager.printf("HTTP %s %s\n",
+                      request.type == REQ_GET ? "GET" : "POST", request.path);
   }
-  Serial.println();
 }
 
 void WebServerManager::logResponse(const ApiResponse &response) {
-  Serial.printf("Response: %d %s (%s)\n", response.status_code,
-                response.is_binary ? "Binary" : "Text", response.content_type);
+  logManager.printf("Response: %d %s (%s)\n", response.status_code,
+                    response.is_binary ? "Binary" : "Text",
+                    response.content_type);
 }
 
 void WebServerManager::extractQueryParam(const char *query_params,
@@ -782,6 +1894,18 @@ void WebServerManager::generateStatusJson(JsonDocument &doc) {
   camera["ready"] = cameraManager.isReady();
   camera["total_captures"] = cameraManager.getTotalCaptureCount();
   camera["failed_captures"] = cameraManager.getFailedCaptureCount();
+
+  // Boot performance
+  JsonObject boot = doc["boot"].to<JsonObject>();
+  boot["first_frame_ms"] = cameraManager.getFirstCaptureTime();
+  boot["uptime_ms"] = millis();
+
+  // Motion detection status
+  JsonObject motion = doc["motion"].to<JsonObject>();
+  motion["active"] = motionManager.isActive();
+  motion["detected"] = motionManager.isMotionDetected();
+  motion["score"] = motionManager.getLastScore();
+  motion["events"] = motionManager.getMotionEventCount();
 }
 
 void WebServerManager::getWiFiProtocol(char *output, size_t max_len) {
@@ -890,1287 +2014,4 @@ int WebServerManager::getWiFiSignalPercentage() {
   }
 }
 
-void WebServerManager::generateWebPage(char *output, size_t max_len) {
-  // Serve the updated HTML content with toggle buttons and spinner
-  const char *html_content =
-      "<!DOCTYPE html>\n"
-      "<html lang=\"en\">\n"
-      "<head>\n"
-      "    <meta charset=\"UTF-8\">\n"
-      "    <meta name=\"viewport\" content=\"width=device-width, "
-      "initial-scale=1.0\">\n"
-      "    <title>ESP32-CAM Live Stream</title>\n"
-      "    <style>\n"
-      "        * {\n"
-      "            margin: 0;\n"
-      "            padding: 0;\n"
-      "            box-sizing: border-box;\n"
-      "        }\n"
-      "\n"
-      "        body {\n"
-      "            font-family: 'Segoe UI', Tahoma, Geneva, Verdana, "
-      "sans-serif;\n"
-      "            background: linear-gradient(135deg, #1e3c72 0%, #2a5298 "
-      "100%);\n"
-      "            color: #fff;\n"
-      "            min-height: 100vh;\n"
-      "        }\n"
-      "\n"
-      "        .container {\n"
-      "            max-width: 1400px;\n"
-      "            margin: 0 auto;\n"
-      "            padding: 20px;\n"
-      "            display: grid;\n"
-      "            grid-template-columns: 2fr 1fr;\n"
-      "            gap: 20px;\n"
-      "            min-height: 100vh;\n"
-      "        }\n"
-      "\n"
-      "        .left-column {\n"
-      "            display: flex;\n"
-      "            flex-direction: column;\n"
-      "            gap: 20px;\n"
-      "        }\n"
-      "\n"
-      "        .video-section {\n"
-      "            background: rgba(255, 255, 255, 0.1);\n"
-      "            border-radius: 15px;\n"
-      "            padding: 20px;\n"
-      "            backdrop-filter: blur(10px);\n"
-      "            border: 1px solid rgba(255, 255, 255, 0.2);\n"
-      "        }\n"
-      "\n"
-      "        .controls-section {\n"
-      "            display: flex;\n"
-      "            flex-direction: column;\n"
-      "            gap: 20px;\n"
-      "        }\n"
-      "\n"
-      "        .control-panel, .payload-panel {\n"
-      "            background: rgba(255, 255, 255, 0.1);\n"
-      "            border-radius: 15px;\n"
-      "            padding: 20px;\n"
-      "            backdrop-filter: blur(10px);\n"
-      "            border: 1px solid rgba(255, 255, 255, 0.2);\n"
-      "        }\n"
-      "\n"
-      "        h1, h2 {\n"
-      "            text-align: center;\n"
-      "            margin-bottom: 20px;\n"
-      "            color: #fff;\n"
-      "        }\n"
-      "\n"
-      "        #stream-container {\n"
-      "            position: relative;\n"
-      "            width: 100%;\n"
-      "            max-width: 100%;\n"
-      "            border-radius: 10px;\n"
-      "            overflow: hidden;\n"
-      "            box-shadow: 0 8px 32px rgba(0, 0, 0, 0.3);\n"
-      "        }\n"
-      "\n"
-      "        #camera-display {\n"
-      "            width: 100%;\n"
-      "            height: auto;\n"
-      "            display: block;\n"
-      "            max-height: 70vh;\n"
-      "            object-fit: contain;\n"
-      "            background: rgba(255, 255, 255, 0.1);\n"
-      "            border: 2px dashed rgba(255, 255, 255, 0.3);\n"
-      "            min-height: 300px;\n"
-      "        }\n"
-      "        \n"
-      "        #camera-placeholder {\n"
-      "            display: flex;\n"
-      "            justify-content: center;\n"
-      "            align-items: center;\n"
-      "            height: 300px;\n"
-      "            color: rgba(255, 255, 255, 0.6);\n"
-      "            font-size: 18px;\n"
-      "            text-align: center;\n"
-      "        }\n"
-      "\n"
-      "        .photo-overlay {\n"
-      "            position: absolute;\n"
-      "            top: 10px;\n"
-      "            right: 10px;\n"
-      "            background: rgba(0, 0, 0, 0.7);\n"
-      "            color: #fff;\n"
-      "            padding: 8px 12px;\n"
-      "            border-radius: 5px;\n"
-      "            font-size: 12px;\n"
-      "            font-family: monospace;\n"
-      "        }\n"
-      "\n"
-      "        .control-group {\n"
-      "            margin-bottom: 20px;\n"
-      "        }\n"
-      "\n"
-      "        .control-group label {\n"
-      "            display: block;\n"
-      "            margin-bottom: 8px;\n"
-      "            font-weight: 600;\n"
-      "            color: #fff;\n"
-      "        }\n"
-      "\n"
-      "        .slider-container {\n"
-      "            position: relative;\n"
-      "            margin-bottom: 15px;\n"
-      "        }\n"
-      "\n"
-      "        .slider {\n"
-      "            width: 100%;\n"
-      "            height: 6px;\n"
-      "            border-radius: 3px;\n"
-      "            background: rgba(255, 255, 255, 0.3);\n"
-      "            outline: none;\n"
-      "            -webkit-appearance: none;\n"
-      "            appearance: none;\n"
-      "        }\n"
-      "\n"
-      "        .slider::-webkit-slider-thumb {\n"
-      "            appearance: none;\n"
-      "            width: 20px;\n"
-      "            height: 20px;\n"
-      "            border-radius: 50%;\n"
-      "            background: #4CAF50;\n"
-      "            cursor: pointer;\n"
-      "            box-shadow: 0 2px 6px rgba(0, 0, 0, 0.3);\n"
-      "        }\n"
-      "\n"
-      "        .slider::-moz-range-thumb {\n"
-      "            width: 20px;\n"
-      "            height: 20px;\n"
-      "            border-radius: 50%;\n"
-      "            background: #4CAF50;\n"
-      "            cursor: pointer;\n"
-      "            border: none;\n"
-      "            box-shadow: 0 2px 6px rgba(0, 0, 0, 0.3);\n"
-      "        }\n"
-      "\n"
-      "        .slider-value {\n"
-      "            position: absolute;\n"
-      "            right: 0;\n"
-      "            top: -25px;\n"
-      "            background: #4CAF50;\n"
-      "            color: white;\n"
-      "            padding: 2px 8px;\n"
-      "            border-radius: 12px;\n"
-      "            font-size: 12px;\n"
-      "            font-weight: bold;\n"
-      "        }\n"
-      "\n"
-      "        .glass-input {\n"
-      "            width: 100%;\n"
-      "            padding: 12px;\n"
-      "            margin-bottom: 10px;\n"
-      "            border: 1px solid rgba(255, 255, 255, 0.2);\n"
-      "            border-radius: 8px;\n"
-      "            background: rgba(255, 255, 255, 0.1);\n"
-      "            color: #fff;\n"
-      "            font-size: 14px;\n"
-      "            outline: none;\n"
-      "            transition: all 0.3s ease;\n"
-      "        }\n"
-      "\n"
-      "        .glass-input:focus {\n"
-      "            background: rgba(255, 255, 255, 0.2);\n"
-      "            border-color: rgba(255, 255, 255, 0.4);\n"
-      "        }\n"
-      "\n"
-      "        select, button {\n"
-      "            width: 100%;\n"
-      "            padding: 12px;\n"
-      "            margin-bottom: 10px;\n"
-      "            border: none;\n"
-      "            border-radius: 8px;\n"
-      "            background: rgba(255, 255, 255, 0.2);\n"
-      "            color: #fff;\n"
-      "            font-size: 14px;\n"
-      "            cursor: pointer;\n"
-      "            transition: all 0.3s ease;\n"
-      "        }\n"
-      "\n"
-      "        select option {\n"
-      "            background: #1e3c72;\n"
-      "            color: #fff;\n"
-      "        }\n"
-      "\n"
-      "        button {\n"
-      "            background: linear-gradient(45deg, #4CAF50, #45a049);\n"
-      "            font-weight: 600;\n"
-      "            text-transform: uppercase;\n"
-      "            letter-spacing: 0.5px;\n"
-      "        }\n"
-      "\n"
-      "        button:hover {\n"
-      "            transform: translateY(-2px);\n"
-      "            box-shadow: 0 4px 12px rgba(76, 175, 80, 0.3);\n"
-      "        }\n"
-      "\n"
-      "        button:active {\n"
-      "            transform: translateY(0);\n"
-      "        }\n"
-      "\n"
-      "        .flash-controls {\n"
-      "            display: grid;\n"
-      "            grid-template-columns: 1fr 1fr;\n"
-      "            gap: 10px;\n"
-      "        }\n"
-      "\n"
-      "        .flash-controls button {\n"
-      "            margin: 0;\n"
-      "        }\n"
-      "\n"
-      "        .payload-display {\n"
-      "            background: #1a1a2e;\n"
-      "            border-radius: 8px;\n"
-      "            padding: 15px;\n"
-      "            font-family: 'Courier New', monospace;\n"
-      "            font-size: 12px;\n"
-      "            line-height: 1.4;\n"
-      "            max-height: 300px;\n"
-      "            overflow-y: auto;\n"
-      "            border: 1px solid rgba(255, 255, 255, 0.1);\n"
-      "        }\n"
-      "\n"
-      "        .payload-display pre {\n"
-      "            margin: 0;\n"
-      "            white-space: pre-wrap;\n"
-      "            word-wrap: break-word;\n"
-      "        }\n"
-      "\n"
-      "        .status-indicator {\n"
-      "            display: inline-block;\n"
-      "            width: 10px;\n"
-      "            height: 10px;\n"
-      "            border-radius: 50%;\n"
-      "            margin-right: 8px;\n"
-      "        }\n"
-      "\n"
-      "        .status-connected {\n"
-      "            background: #4CAF50;\n"
-      "            box-shadow: 0 0 10px #4CAF50;\n"
-      "        }\n"
-      "\n"
-      "        .status-disconnected {\n"
-      "            background: #f44336;\n"
-      "            box-shadow: 0 0 10px #f44336;\n"
-      "        }\n"
-      "\n"
-      "        .timestamp {\n"
-      "            color: #888;\n"
-      "            font-size: 10px;\n"
-      "            margin-bottom: 10px;\n"
-      "        }\n"
-      "\n"
-      "        @media (max-width: 1024px) {\n"
-      "            .container {\n"
-      "                grid-template-columns: 1fr;\n"
-      "                gap: 15px;\n"
-      "            }\n"
-      "            \n"
-      "            .left-column {\n"
-      "                order: 1;\n"
-      "            }\n"
-      "            \n"
-      "            .controls-section {\n"
-      "                order: 2;\n"
-      "            }\n"
-      "        }\n"
-      "\n"
-      "        .loading {\n"
-      "            display: flex;\n"
-      "            justify-content: center;\n"
-      "            align-items: center;\n"
-      "            height: 300px;\n"
-      "            font-size: 18px;\n"
-      "            color: #ccc;\n"
-      "        }\n"
-      "\n"
-      "        .wifi-info-grid {\n"
-      "            display: grid;\n"
-      "            grid-template-columns: repeat(auto-fit, minmax(250px, "
-      "1fr));\n"
-      "            gap: 15px;\n"
-      "            margin-bottom: 20px;\n"
-      "        }\n"
-      "\n"
-      "        .info-item {\n"
-      "            background: rgba(255, 255, 255, 0.05);\n"
-      "            padding: 12px;\n"
-      "            border-radius: 8px;\n"
-      "            border: 1px solid rgba(255, 255, 255, 0.1);\n"
-      "        }\n"
-      "\n"
-      "        .info-item label {\n"
-      "            display: block;\n"
-      "            font-size: 12px;\n"
-      "            color: rgba(255, 255, 255, 0.7);\n"
-      "            margin-bottom: 5px;\n"
-      "            text-transform: uppercase;\n"
-      "            letter-spacing: 0.5px;\n"
-      "        }\n"
-      "\n"
-      "        .info-value {\n"
-      "            font-size: 14px;\n"
-      "            font-weight: 600;\n"
-      "            color: #fff;\n"
-      "            font-family: 'Courier New', monospace;\n"
-      "        }\n"
-      "\n"
-      "        .wifi-status {\n"
-      "            display: flex;\n"
-      "            align-items: center;\n"
-      "            justify-content: center;\n"
-      "            padding: 15px;\n"
-      "            background: rgba(255, 255, 255, 0.05);\n"
-      "            border-radius: 8px;\n"
-      "            border: 1px solid rgba(255, 255, 255, 0.1);\n"
-      "        }\n"
-      "\n"
-      "        .checkbox-group {\n"
-      "            display: flex;\n"
-      "            flex-direction: column;\n"
-      "            gap: 10px;\n"
-      "        }\n"
-      "\n"
-      "        .checkbox-label {\n"
-      "            display: flex;\n"
-      "            align-items: center;\n"
-      "            cursor: pointer;\n"
-      "            font-size: 14px;\n"
-      "            font-weight: normal !important;\n"
-      "            margin-bottom: 0 !important;\n"
-      "        }\n"
-      "\n"
-      "        /* Toggle control styles */\n"
-      "        .toggle-control {\n"
-      "            display: flex;\n"
-      "            align-items: center;\n"
-      "            justify-content: space-between;\n"
-      "            margin-bottom: 15px;\n"
-      "        }\n"
-      "\n"
-      "        .toggle-control label {\n"
-      "            margin-bottom: 0 !important;\n"
-      "            font-weight: 500;\n"
-      "            color: #fff;\n"
-      "        }\n"
-      "\n"
-      "        .toggle-switch {\n"
-      "            position: relative;\n"
-      "            width: 60px;\n"
-      "            height: 30px;\n"
-      "            background: rgba(255, 255, 255, 0.3);\n"
-      "            border-radius: 15px;\n"
-      "            cursor: pointer;\n"
-      "            transition: all 0.3s ease;\n"
-      "            border: none;\n"
-      "            outline: none;\n"
-      "        }\n"
-      "\n"
-      "        .toggle-switch.on {\n"
-      "            background: rgba(76, 175, 80, 0.8);\n"
-      "        }\n"
-      "\n"
-      "        .toggle-switch::before {\n"
-      "            content: '';\n"
-      "            position: absolute;\n"
-      "            top: 3px;\n"
-      "            left: 3px;\n"
-      "            width: 24px;\n"
-      "            height: 24px;\n"
-      "            background: #fff;\n"
-      "            border-radius: 50%;\n"
-      "            transition: all 0.3s ease;\n"
-      "            box-shadow: 0 2px 6px rgba(0, 0, 0, 0.3);\n"
-      "        }\n"
-      "\n"
-      "        .toggle-switch.on::before {\n"
-      "            transform: translateX(30px);\n"
-      "        }\n"
-      "\n"
-      "        .toggle-switch:hover {\n"
-      "            transform: scale(1.05);\n"
-      "        }\n"
-      "\n"
-      "        .toggle-switch:active {\n"
-      "            transform: scale(0.95);\n"
-      "        }\n"
-      "\n"
-      "        /* Spinner styles */\n"
-      "        .spinner-overlay {\n"
-      "            position: absolute;\n"
-      "            top: 0;\n"
-      "            left: 0;\n"
-      "            right: 0;\n"
-      "            bottom: 0;\n"
-      "            background: rgba(0, 0, 0, 0.8);\n"
-      "            display: none;\n"
-      "            justify-content: center;\n"
-      "            align-items: center;\n"
-      "            border-radius: 10px;\n"
-      "            z-index: 10;\n"
-      "        }\n"
-      "\n"
-      "        .spinner-container {\n"
-      "            display: flex;\n"
-      "            flex-direction: column;\n"
-      "            align-items: center;\n"
-      "            justify-content: center;\n"
-      "        }\n"
-      "\n"
-      "        .spinner {\n"
-      "            width: 60px;\n"
-      "            height: 60px;\n"
-      "            border: 4px solid rgba(255, 255, 255, 0.3);\n"
-      "            border-top: 4px solid #4CAF50;\n"
-      "            border-radius: 50%;\n"
-      "            animation: spin 1s linear infinite;\n"
-      "            margin-bottom: 15px;\n"
-      "        }\n"
-      "\n"
-      "        .spinner-text {\n"
-      "            color: #fff;\n"
-      "            font-size: 16px;\n"
-      "            font-weight: 600;\n"
-      "            text-align: center;\n"
-      "        }\n"
-      "\n"
-      "        @keyframes spin {\n"
-      "            0% { transform: rotate(0deg); }\n"
-      "            100% { transform: rotate(360deg); }\n"
-      "        }\n"
-      "\n"
-      "        @media (max-width: 768px) {\n"
-      "            .wifi-info-grid {\n"
-      "                grid-template-columns: 1fr;\n"
-      "            }\n"
-      "        }\n"
-      "\n"
-      "    </style>\n"
-      "</head>\n"
-      "<body>\n"
-      "    <div class=\"container\">\n"
-      "        <div class=\"left-column\">\n"
-      "            <div class=\"video-section\">\n"
-      "                <h1>ESP32-CAM Photo Capture</h1>\n"
-      "                <div id=\"stream-container\">\n"
-      "                    <div id=\"camera-placeholder\">\n"
-      "                        <div>\n"
-      "                            <p>Click \"Take Photo\" to capture an "
-      "image</p>\n"
-      "                            <p style=\"font-size: 14px; margin-top: "
-      "10px; color: rgba(255, 255, 255, 0.4);\">Adjust settings below and "
-      "click capture</p>\n"
-      "                        </div>\n"
-      "                    </div>\n"
-      "                    <img id=\"camera-display\" src=\"\" alt=\"ESP32-CAM "
-      "Photo\" style=\"display: none;\">\n"
-      "                    <div class=\"photo-overlay\" style=\"display: "
-      "none;\">\n"
-      "                        <span class=\"status-indicator\" "
-      "id=\"connection-status\"></span>\n"
-      "                        <span id=\"photo-status\">Ready</span>\n"
-      "                    </div>\n"
-      "                    <div class=\"spinner-overlay\" "
-      "id=\"spinner-overlay\">\n"
-      "                        <div class=\"spinner-container\">\n"
-      "                            <div class=\"spinner\"></div>\n"
-      "                            <div class=\"spinner-text\">Capturing "
-      "Photo...</div>\n"
-      "                        </div>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "            </div>\n"
-      "\n"
-      "            <div class=\"video-section\">\n"
-      "                <h2>WiFi Settings</h2>\n"
-      "                <div class=\"wifi-info-grid\">\n"
-      "                    <div class=\"info-item\">\n"
-      "                        <label>Network Name (SSID):</label>\n"
-      "                        <div class=\"info-value\" "
-      "id=\"wifi-ssid\">Loading...</div>\n"
-      "                    </div>\n"
-      "                    <div class=\"info-item\">\n"
-      "                        <label>IP Address:</label>\n"
-      "                        <div class=\"info-value\" "
-      "id=\"wifi-ip\">Loading...</div>\n"
-      "                    </div>\n"
-      "                    <div class=\"info-item\">\n"
-      "                        <label>Connection Mode:</label>\n"
-      "                        <div class=\"info-value\" "
-      "id=\"wifi-mode\">Loading...</div>\n"
-      "                    </div>\n"
-      "                    <div class=\"info-item\">\n"
-      "                        <label>Signal Strength:</label>\n"
-      "                        <div class=\"info-value\" "
-      "id=\"wifi-signal\">Loading...</div>\n"
-      "                    </div>\n"
-      "                    <div class=\"info-item\">\n"
-      "                        <label>TX Power:</label>\n"
-      "                        <div class=\"info-value\" "
-      "id=\"wifi-txpower\">Loading...</div>\n"
-      "                    </div>\n"
-      "                    <div class=\"info-item\">\n"
-      "                        <label>Gateway:</label>\n"
-      "                        <div class=\"info-value\" "
-      "id=\"wifi-gateway\">Loading...</div>\n"
-      "                    </div>\n"
-      "                    <div class=\"info-item\">\n"
-      "                        <label>MAC Address:</label>\n"
-      "                        <div class=\"info-value\" "
-      "id=\"wifi-mac\">Loading...</div>\n"
-      "                    </div>\n"
-      "                    <div class=\"info-item\">\n"
-      "                        <label>WiFi Protocol:</label>\n"
-      "                        <div class=\"info-value\" "
-      "id=\"wifi-protocol\">Loading...</div>\n"
-      "                    </div>\n"
-      "                    <div class=\"info-item\">\n"
-      "                        <label>Connection Speed:</label>\n"
-      "                        <div class=\"info-value\" "
-      "id=\"wifi-speed\">Loading...</div>\n"
-      "                    </div>\n"
-      "                    <div class=\"info-item\">\n"
-      "                        <label>Channel Bandwidth:</label>\n"
-      "                        <div class=\"info-value\" "
-      "id=\"wifi-bandwidth\">Loading...</div>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "                <div class=\"wifi-status\">\n"
-      "                    <span class=\"status-indicator\" "
-      "id=\"wifi-status-indicator\"></span>\n"
-      "                    <span id=\"wifi-status-text\">Checking "
-      "connection...</span>\n"
-      "                </div>\n"
-      "\n"
-      "                <hr style=\"border-color: rgba(255,255,255,0.15); margin: 20px 0;\">\n"
-      "                <h3 style=\"margin-top: 20px; margin-bottom: 15px; text-align: center;\">WiFi Config</h3>\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label for=\"wifi-ssid-input\">New SSID:</label>\n"
-      "                    <input type=\"text\" id=\"wifi-ssid-input\" class=\"glass-input\" maxlength=\"63\" placeholder=\"Network name\">\n"
-      "                </div>\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label for=\"wifi-pw-input\">Password:</label>\n"
-      "                    <div style=\"display:flex; gap:10px;\">\n"
-      "                        <input type=\"password\" id=\"wifi-pw-input\" class=\"glass-input\" style=\"flex:1;\" maxlength=\"63\" placeholder=\"Password\">\n"
-      "                        <button id=\"wifi-toggle-pw\" style=\"width:80px; padding:10px; background: rgba(255, 255, 255, 0.2); border: none; color: white; border-radius: 8px; cursor: pointer;\">SHOW</button>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label for=\"wifi-bw-select\">Bandwidth:</label>\n"
-      "                    <select id=\"wifi-bw-select\" class=\"glass-input\">\n"
-      "                        <option value=\"0\">📡 Max Range (Slowest) - 802.11b</option>\n"
-      "                        <option value=\"1\">⚖️ Balanced Speed - HT20</option>\n"
-      "                        <option value=\"2\">⚡ Max Speed (Close Range) - HT40</option>\n"
-      "                    </select>\n"
-      "                </div>\n"
-      "                <button id=\"wifi-apply-btn\" style=\"background: linear-gradient(45deg, #4CAF50, #45a049); border: none; color: white; width: 100%; padding: 12px; border-radius: 8px; font-weight: 600; cursor: pointer; text-transform: uppercase;\">APPLY WIFI SETTINGS</button>\n"
-      "                <div id=\"wifi-result\" style=\"margin-top: 15px; padding: 10px; border-radius: 8px; display: none; text-align: center; font-size: 13px;\"></div>\n"      "            </div>\n"
-      "        </div>\n"
-      "\n"
-      "        <div class=\"controls-section\">\n"
-      "            <div class=\"control-panel\">\n"
-      "                <h2>Camera Controls</h2>\n"
-      "                \n"
-      "                <div class=\"control-group\">\n"
-      "                    <label for=\"resolution-select\">Resolution:</label>\n"
-      "                    <select id=\"resolution-select\">\n"
-      "                        <option value=\"UXGA\">UXGA (1600x1200)</option>\n"
-      "                        <option value=\"SXGA\">SXGA (1280x1024)</option>\n"
-      "                        <option value=\"XGA\">XGA (1024x768)</option>\n"
-      "                        <option value=\"SVGA\">SVGA (800x600)</option>\n"
-      "                        <option value=\"VGA\" selected>VGA (640x480)</option>\n"
-      "                        <option value=\"CIF\">CIF (400x296)</option>\n"
-      "                        <option value=\"QVGA\">QVGA (320x240)</option>\n"
-      "                    </select>\n"
-      "                </div>\n"
-      "\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label>Brightness:</label>\n"
-      "                    <div class=\"slider-container\">\n"
-      "                        <input type=\"range\" id=\"brightness-slider\" "
-      "class=\"slider\" min=\"-2\" max=\"2\" value=\"0\" step=\"1\">\n"
-      "                        <span class=\"slider-value\" "
-      "id=\"brightness-value\">0</span>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label>Contrast:</label>\n"
-      "                    <div class=\"slider-container\">\n"
-      "                        <input type=\"range\" id=\"contrast-slider\" "
-      "class=\"slider\" min=\"-2\" max=\"2\" value=\"2\" step=\"1\">\n"
-      "                        <span class=\"slider-value\" "
-      "id=\"contrast-value\">2</span>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label>Exposure:</label>\n"
-      "                    <div class=\"slider-container\">\n"
-      "                        <input type=\"range\" id=\"exposure-slider\" "
-      "class=\"slider\" min=\"0\" max=\"1200\" value=\"300\" step=\"50\">\n"
-      "                        <span class=\"slider-value\" "
-      "id=\"exposure-value\">300</span>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label>JPEG Quality:</label>\n"
-      "                    <div class=\"slider-container\">\n"
-      "                        <input type=\"range\" id=\"quality-slider\" "
-      "class=\"slider\" min=\"10\" max=\"63\" value=\"10\" step=\"1\">\n"
-      "                        <span class=\"slider-value\" "
-      "id=\"quality-value\">10</span>\n"
-      "                        <small style=\"color: #aaa; display: block; "
-      "margin-top: 4px;\">10 = Best, 63 = Worst</small>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label>Saturation:</label>\n"
-      "                    <div class=\"slider-container\">\n"
-      "                        <input type=\"range\" id=\"saturation-slider\" "
-      "class=\"slider\" min=\"-2\" max=\"2\" value=\"1\" step=\"1\">\n"
-      "                        <span class=\"slider-value\" "
-      "id=\"saturation-value\">1</span>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label>Gain:</label>\n"
-      "                    <div class=\"slider-container\">\n"
-      "                        <input type=\"range\" id=\"gain-slider\" "
-      "class=\"slider\" min=\"0\" max=\"30\" value=\"1\" step=\"1\">\n"
-      "                        <span class=\"slider-value\" "
-      "id=\"gain-value\">1</span>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label>Special Effect:</label>\n"
-      "                    <select id=\"special-effect-select\">\n"
-      "                        <option value=\"0\">None</option>\n"
-      "                        <option value=\"1\">Negative</option>\n"
-      "                        <option value=\"2\">Grayscale</option>\n"
-      "                        <option value=\"3\">Red Tint</option>\n"
-      "                        <option value=\"4\">Green Tint</option>\n"
-      "                        <option value=\"5\">Blue Tint</option>\n"
-      "                        <option value=\"6\">Sepia</option>\n"
-      "                    </select>\n"
-      "                </div>\n"
-      "\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label>White Balance Mode:</label>\n"
-      "                    <select id=\"wb-mode-select\">\n"
-      "                        <option value=\"0\">Auto</option>\n"
-      "                        <option value=\"1\">Sunny</option>\n"
-      "                        <option value=\"2\">Cloudy</option>\n"
-      "                        <option value=\"3\">Office</option>\n"
-      "                        <option value=\"4\">Home</option>\n"
-      "                    </select>\n"
-      "                </div>\n"
-      "\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label>Image Options:</label>\n"
-      "                    <div class=\"toggle-control\">\n"
-      "                        <label>Horizontal Mirror</label>\n"
-      "                        <button class=\"toggle-switch off\" "
-      "id=\"hmirror-toggle\"></button>\n"
-      "                    </div>\n"
-      "                    <div class=\"toggle-control\">\n"
-      "                        <label>Vertical Flip</label>\n"
-      "                        <button class=\"toggle-switch off\" "
-      "id=\"vflip-toggle\"></button>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "\n"
-      "                <div class=\"control-group\">\n"
-      "                    <label>Flash Control:</label>\n"
-      "                    <div class=\"toggle-control\">\n"
-      "                        <label>Flash</label>\n"
-      "                        <button class=\"toggle-switch off\" "
-      "id=\"flash-toggle\"></button>\n"
-      "                    </div>\n"
-      "                </div>\n"
-      "\n"
-      "                <button id=\"reset-btn\" style=\"background: "
-      "linear-gradient(45deg, #f44336, #d32f2f); margin-bottom: 10px;\">Reset "
-      "to Defaults</button>\n"
-      "                <button id=\"capture-btn\">SNAPSHOT</button>\n"
-      "            </div>\n"
-      "\n"
-      "            <div class=\"payload-panel\">\n"
-      "                <h2>API Payload</h2>\n"
-      "                <div class=\"timestamp\" id=\"last-updated\">Last "
-      "updated: Never</div>\n"
-      "                <div class=\"payload-display\">\n"
-      "                    <pre id=\"payload-content\">{\n"
-      "  \"resolution\": \"VGA\",\n"
-      "  \"flash\": \"off\",\n"
-      "  \"brightness\": 0,\n"
-      "  \"contrast\": 2,\n"
-      "  \"exposure\": 300\n"
-      "}</pre>\n"
-      "                </div>\n"
-      "            </div>\n"
-      "        </div>\n"
-      "    </div>\n"
-      "\n"
-      "    <script>\n"
-      "        class ESP32CameraController {\n"
-      "            constructor() {\n"
-      "                // Use dynamic baseUrl from current page location\n"
-      "                this.baseUrl = window.location.protocol + '//' + "
-      "window.location.host;\n"
-      "                this.apiKey = null;\n"
-      "                this.isConnected = false;\n"
-      "                this.currentSettings = {\n"
-      "                    resolution: 'VGA',\n"
-      "                    quality: 10,\n"
-      "                    flash: 'off',\n"
-      "                    brightness: 0,\n"
-      "                    contrast: 2,\n"
-      "                    saturation: 1,\n"
-      "                    exposure: 300,\n"
-      "                    gain: 1,\n"
-      "                    special_effect: 0,\n"
-      "                    wb_mode: 0,\n"
-      "                    hmirror: false,\n"
-      "                    vflip: false\n"
-      "                };\n"
-      "                \n"
-      "                this.init();\n"
-      "            }\n"
-      "\n"
-      "            init() {\n"
-      "                this.bindEvents();\n"
-      "                this.updatePayloadDisplay();\n"
-      "                this.loadWiFiInfo();\n"
-      "            }\n"
-      "\n"
-      "            async loadAPIKey() {\n"
-      "                // Try to get API key from localStorage or prompt user\n"
-      "                const storedKey = "
-      "localStorage.getItem('esp32cam_api_key');\n"
-      "                if (storedKey) {\n"
-      "                    this.apiKey = storedKey;\n"
-      "                    console.log('API key loaded from localStorage');\n"
-      "                } else {\n"
-      "                    // Prompt user to enter API key (for first time "
-      "setup)\n"
-      "                    const userKey = prompt('Enter API key (check Serial "
-      "monitor for generated key):');\n"
-      "                    if (userKey && userKey.trim()) {\n"
-      "                        this.apiKey = userKey.trim();\n"
-      "                        localStorage.setItem('esp32cam_api_key', "
-      "this.apiKey);\n"
-      "                        console.log('API key saved to localStorage');\n"
-      "                    } else {\n"
-      "                        console.warn('No API key provided - requests "
-      "may fail');\n"
-      "                    }\n"
-      "                }\n"
-      "            }\n"
-      "\n"
-      "            getAuthHeaders() {\n"
-      "                return {\n"
-      "                    'Content-Type': 'application/json'\n"
-      "                };\n"
-      "            }\n"
-      "\n"
-      "            bindEvents() {\n"
-      "                // Resolution change\n"
-      "                "
-      "document.getElementById('resolution-select').addEventListener('change', "
-      "(e) => {\n"
-      "                    this.currentSettings.resolution = e.target.value;\n"
-      "                    this.updatePayloadDisplay();\n"
-      "                });\n"
-      "\n"
-      "                // Brightness control\n"
-      "                const brightnessSlider = "
-      "document.getElementById('brightness-slider');\n"
-      "                const brightnessValue = "
-      "document.getElementById('brightness-value');\n"
-      "                brightnessSlider.addEventListener('input', (e) => {\n"
-      "                    const value = parseInt(e.target.value);\n"
-      "                    this.currentSettings.brightness = value;\n"
-      "                    brightnessValue.textContent = value;\n"
-      "                    this.updateCameraSetting('brightness', value);\n"
-      "                    this.updatePayloadDisplay();\n"
-      "                });\n"
-      "\n"
-      "                // Contrast control\n"
-      "                const contrastSlider = "
-      "document.getElementById('contrast-slider');\n"
-      "                const contrastValue = "
-      "document.getElementById('contrast-value');\n"
-      "                contrastSlider.addEventListener('input', (e) => {\n"
-      "                    const value = parseInt(e.target.value);\n"
-      "                    this.currentSettings.contrast = value;\n"
-      "                    contrastValue.textContent = value;\n"
-      "                    this.updateCameraSetting('contrast', value);\n"
-      "                    this.updatePayloadDisplay();\n"
-      "                });\n"
-      "\n"
-      "                // Exposure control\n"
-      "                const exposureSlider = "
-      "document.getElementById('exposure-slider');\n"
-      "                const exposureValue = "
-      "document.getElementById('exposure-value');\n"
-      "                exposureSlider.addEventListener('input', (e) => {\n"
-      "                    const value = parseInt(e.target.value);\n"
-      "                    this.currentSettings.exposure = value;\n"
-      "                    exposureValue.textContent = value;\n"
-      "                    this.updateCameraSetting('exposure', value);\n"
-      "                    this.updatePayloadDisplay();\n"
-      "                });\n"
-      "\n"
-      "                // Saturation control\n"
-      "                const saturationSlider = "
-      "document.getElementById('saturation-slider');\n"
-      "                const saturationValue = "
-      "document.getElementById('saturation-value');\n"
-      "                saturationSlider.addEventListener('input', (e) => {\n"
-      "                    const value = parseInt(e.target.value);\n"
-      "                    this.currentSettings.saturation = value;\n"
-      "                    saturationValue.textContent = value;\n"
-      "                    this.updateCameraSetting('saturation', value);\n"
-      "                    this.updatePayloadDisplay();\n"
-      "                });\n"
-      "\n"
-      "                // Gain control\n"
-      "                const gainSlider = "
-      "document.getElementById('gain-slider');\n"
-      "                const gainValue = "
-      "document.getElementById('gain-value');\n"
-      "                gainSlider.addEventListener('input', (e) => {\n"
-      "                    const value = parseInt(e.target.value);\n"
-      "                    this.currentSettings.gain = value;\n"
-      "                    gainValue.textContent = value;\n"
-      "                    this.updateCameraSetting('gain', value);\n"
-      "                    this.updatePayloadDisplay();\n"
-      "                });\n"
-      "\n"
-      "                // Quality control\n"
-      "                const qualitySlider = "
-      "document.getElementById('quality-slider');\n"
-      "                const qualityValue = "
-      "document.getElementById('quality-value');\n"
-      "                qualitySlider.addEventListener('input', (e) => {\n"
-      "                    const value = parseInt(e.target.value);\n"
-      "                    this.currentSettings.quality = value;\n"
-      "                    qualityValue.textContent = value;\n"
-      "                    this.updatePayloadDisplay();\n"
-      "                });\n"
-      "\n"
-      "                // Special Effect control\n"
-      "                "
-      "document.getElementById('special-effect-select').addEventListener('"
-      "change', (e) => {\n"
-      "                    this.currentSettings.special_effect = "
-      "parseInt(e.target.value);\n"
-      "                    this.updatePayloadDisplay();\n"
-      "                });\n"
-      "\n"
-      "                // White Balance Mode control\n"
-      "                "
-      "document.getElementById('wb-mode-select').addEventListener('change', "
-      "(e) => {\n"
-      "                    this.currentSettings.wb_mode = "
-      "parseInt(e.target.value);\n"
-      "                    this.updatePayloadDisplay();\n"
-      "                });\n"
-      "\n"
-      "                // Toggle button controls\n"
-      "                "
-      "document.getElementById('flash-toggle').addEventListener('click', () => "
-      "{\n"
-      "                    this.toggleFlash();\n"
-      "                });\n"
-      "\n"
-      "                "
-      "document.getElementById('hmirror-toggle').addEventListener('click', () "
-      "=> {\n"
-      "                    this.toggleHMirror();\n"
-      "                });\n"
-      "\n"
-      "                "
-      "document.getElementById('vflip-toggle').addEventListener('click', () => "
-      "{\n"
-      "                    this.toggleVFlip();\n"
-      "                });\n"
-      "\n"
-      "                // Reset button\n"
-      "                "
-      "document.getElementById('reset-btn').addEventListener('click', () => {\n"
-      "                    this.resetToDefaults();\n"
-      "                });\n"
-      "\n"
-      "                // Capture button\n"
-      "                "
-      "document.getElementById('capture-btn').addEventListener('click', () => "
-      "{\n"
-      "                    this.takePhoto();\n"
-      "                });\n"
-      "\n"
-      "                // WiFi Config\n"
-      "                document.getElementById('wifi-toggle-pw').addEventListener("
-      "'click', () => {\n"
-      "                    const inp = document.getElementById("
-      "'wifi-pw-input');\n"
-      "                    if (inp.type === 'password') { inp.type = 'text'; }\n"
-      "                    else { inp.type = 'password'; }\n"
-      "                });\n"
-      "\n"
-      "                document.getElementById('wifi-apply-btn').addEventListener("
-      "'click', async () => {\n"
-      "                    const s = document.getElementById("
-      "'wifi-ssid-input').value.trim();\n"
-      "                    const p = document.getElementById("
-      "'wifi-pw-input').value;\n"
-      "                    const b = parseInt(document.getElementById("
-      "'wifi-bw-select').value);\n"
-      "                    const pl = {bandwidth: b};\n"
-      "                    if (s) pl.ssid = s;\n"
-      "                    if (p) pl.password = p;\n"
-      "                    const r = document.getElementById('wifi-result');\n"
-      "                    r.style.display = 'block';\n"
-      "                    r.textContent = 'Applying...';\n"
-      "                    r.style.background = '#2196f3';\n"
-      "                    try {\n"
-      "                        const res = await fetch('/wifi', {method:"
-      " 'POST', headers: this.getAuthHeaders(), body: JSON.stringify(pl)});\n"
-      "                        const d = await res.json();\n"
-      "                        if (d.status === 'success') {\n"
-      "                            r.style.background = '#4caf50';\n"
-      "                            r.textContent = d.message;\n"
-      "                            setTimeout(() => location.reload(), 2000);\n"
-      "                        } else {\n"
-      "                            r.style.background = '#f44336';\n"
-      "                            r.textContent = d.error || 'Error';\n"
-      "                        }\n"
-      "                    } catch (e) {\n"
-      "                        r.style.background = '#FFA500';\n"
-      "                        r.textContent = 'Settings applied! Device reconnecting... Reloading page in 5 seconds...';\n"
-      "                        setTimeout(() => location.reload(), 5000);\n"
-      "                    }\n"
-      "                });\n"
-      "            }\n"
-      "\n"
-      "            async updateCameraSetting(setting, value) {\n"
-      "                // Camera settings are applied in real-time through the "
-      "stream\n"
-      "                console.log(`${setting} updated to ${value}`);\n"
-      "            }\n"
-      "\n"
-      "            toggleFlash() {\n"
-      "                const isOn = this.currentSettings.flash === 'on';\n"
-      "                this.currentSettings.flash = isOn ? 'off' : 'on';\n"
-      "                this.updateToggleButton('flash-toggle', 'flash-text', "
-      "'Flash', !isOn);\n"
-      "                this.updatePayloadDisplay();\n"
-      "            }\n"
-      "\n"
-      "            toggleHMirror() {\n"
-      "                this.currentSettings.hmirror = "
-      "!this.currentSettings.hmirror;\n"
-      "                this.updateToggleButton('hmirror-toggle', "
-      "'hmirror-text', 'Horizontal Mirror', this.currentSettings.hmirror);\n"
-      "                this.updatePayloadDisplay();\n"
-      "            }\n"
-      "\n"
-      "            toggleVFlip() {\n"
-      "                this.currentSettings.vflip = "
-      "!this.currentSettings.vflip;\n"
-      "                this.updateToggleButton('vflip-toggle', 'vflip-text', "
-      "'Vertical Flip', this.currentSettings.vflip);\n"
-      "                this.updatePayloadDisplay();\n"
-      "            }\n"
-      "\n"
-      "            updateToggleButton(buttonId, textId, label, isOn) {\n"
-      "                const button = document.getElementById(buttonId);\n"
-      "                button.className = `toggle-switch ${isOn ? 'on' : "
-      "'off'}`;\n"
-      "            }\n"
-      "\n"
-      "            resetToDefaults() {\n"
-      "                // Reset all settings to default values\n"
-      "                this.currentSettings = {\n"
-      "                    resolution: 'VGA',\n"
-      "                    quality: 10,\n"
-      "                    flash: 'off',\n"
-      "                    brightness: 0,\n"
-      "                    contrast: 2,\n"
-      "                    saturation: 1,\n"
-      "                    exposure: 300,\n"
-      "                    gain: 1,\n"
-      "                    special_effect: 0,\n"
-      "                    wb_mode: 0,\n"
-      "                    hmirror: false,\n"
-      "                    vflip: false\n"
-      "                };\n"
-      "\n"
-      "                // Update all UI elements\n"
-      "                document.getElementById('resolution-select').value = "
-      "'VGA';\n"
-      "                \n"
-      "                // Reset sliders\n"
-      "                document.getElementById('brightness-slider').value = "
-      "0;\n"
-      "                document.getElementById('brightness-value').textContent "
-      "= '0';\n"
-      "                document.getElementById('contrast-slider').value = 2;\n"
-      "                document.getElementById('contrast-value').textContent = "
-      "'2';\n"
-      "                document.getElementById('saturation-slider').value = "
-      "1;\n"
-      "                document.getElementById('saturation-value').textContent "
-      "= '1';\n"
-      "                document.getElementById('exposure-slider').value = "
-      "300;\n"
-      "                document.getElementById('exposure-value').textContent = "
-      "'300';\n"
-      "                document.getElementById('gain-slider').value = 1;\n"
-      "                document.getElementById('gain-value').textContent = "
-      "'1';\n"
-      "                document.getElementById('quality-slider').value = 10;\n"
-      "                document.getElementById('quality-value').textContent = "
-      "'10';\n"
-      "                \n"
-      "                // Reset select dropdowns\n"
-      "                document.getElementById('special-effect-select').value "
-      "= '0';\n"
-      "                document.getElementById('wb-mode-select').value = '0';\n"
-      "                \n"
-      "                // Reset toggle switches\n"
-      "                this.updateToggleButton('flash-toggle', null, 'Flash', "
-      "false);\n"
-      "                this.updateToggleButton('hmirror-toggle', null, "
-      "'Horizontal Mirror', false);\n"
-      "                this.updateToggleButton('vflip-toggle', null, 'Vertical "
-      "Flip', false);\n"
-      "                \n"
-      "                // Update payload display\n"
-      "                this.updatePayloadDisplay();\n"
-      "                \n"
-      "                console.log('Settings reset to defaults');\n"
-      "            }\n"
-      "\n"
-      "            async takePhoto() {\n"
-      "                const { resolution, quality, flash, brightness, contrast, "
-      "saturation, exposure, gain, special_effect, wb_mode, hmirror, vflip } = "
-      "this.currentSettings;\n"
-      "                \n"
-      "                // Use POST /snapshot with flat structure (not nested)\n"
-      "                const url = `${this.baseUrl}/snapshot`;\n"
-      "                const payload = {\n"
-      "                    resolution: resolution,\n"
-      "                    quality: parseInt(quality),\n"
-      "                    flash: flash === 'on',\n"
-      "                    brightness: brightness,\n"
-      "                    contrast: contrast,\n"
-      "                    saturation: saturation,\n"
-      "                    exposure: exposure,\n"
-      "                    gain: gain,\n"
-      "                    special_effect: special_effect,\n"
-      "                    wb_mode: wb_mode,\n"
-      "                    hmirror: hmirror,\n"
-      "                    vflip: vflip\n"
-      "                };\n"
-      "                \n"
-      "                // Update UI to show capturing state\n"
-      "                const captureBtn = "
-      "document.getElementById('capture-btn');\n"
-      "                const spinnerOverlay = "
-      "document.getElementById('spinner-overlay');\n"
-      "                const originalText = captureBtn.textContent;\n"
-      "                captureBtn.textContent = 'Capturing...';\n"
-      "                captureBtn.disabled = true;\n"
-      "                spinnerOverlay.style.display = 'flex';\n"
-      "                \n"
-      "                try {\n"
-      "                    const response = await fetch(url, {\n"
-      "                        method: 'POST',\n"
-      "                        headers: this.getAuthHeaders(),\n"
-      "                        body: JSON.stringify(payload)\n"
-      "                    });\n"
-      "                    \n"
-      "                    if (response.ok) {\n"
-      "                        const blob = await response.blob();\n"
-      "                        const imageUrl = URL.createObjectURL(blob);\n"
-      "                        \n"
-      "                        // Display the captured image\n"
-      "                        const imageDisplay = "
-      "document.getElementById('camera-display');\n"
-      "                        const placeholder = "
-      "document.getElementById('camera-placeholder');\n"
-      "                        const overlay = "
-      "document.querySelector('.photo-overlay');\n"
-      "                        \n"
-      "                        imageDisplay.src = imageUrl;\n"
-      "                        imageDisplay.style.display = 'block';\n"
-      "                        placeholder.style.display = 'none';\n"
-      "                        overlay.style.display = 'block';\n"
-      "                        \n"
-      "                        "
-      "document.getElementById('connection-status').className = "
-      "'status-indicator status-connected';\n"
-      "                        "
-      "document.getElementById('photo-status').textContent = 'Photo "
-      "captured';\n"
-      "                        \n"
-      "                        console.log('Photo captured successfully');\n"
-      "                        this.updatePayloadDisplay();\n"
-      "                        \n"
-      "                        // Update connection status\n"
-      "                        if (!this.isConnected) {\n"
-      "                            this.isConnected = true;\n"
-      "                        }\n"
-      "                    } else {\n"
-      "                        const errorData = await response.json();\n"
-      "                        throw new Error(errorData.error || 'Failed to capture photo');\n"
-      "                    }\n"
-      "                } catch (error) {\n"
-      "                    console.error('Failed to capture photo:', error);\n"
-      "                    const overlay = "
-      "document.querySelector('.photo-overlay');\n"
-      "                    overlay.style.display = 'block';\n"
-      "                    "
-      "document.getElementById('connection-status').className = "
-      "'status-indicator status-disconnected';\n"
-      "                    document.getElementById('photo-status').textContent "
-      "= 'ERROR: ' + error.message;\n"
-      "                    this.isConnected = false;\n"
-      "                } finally {\n"
-      "                    captureBtn.textContent = originalText;\n"
-      "                    captureBtn.disabled = false;\n"
-      "                    spinnerOverlay.style.display = 'none';\n"
-      "                }\n"
-      "            }\n"
-      "\n"
-      "\n"
-      "            async loadWiFiInfo() {\n"
-      "                try {\n"
-      "                    const headers = {};\n"
-      "                    if (this.apiKey) {\n"
-      "                        headers['Authorization'] = 'Bearer ' + "
-      "this.apiKey;\n"
-      "                    }\n"
-      "                    const response = await "
-      "fetch(`${this.baseUrl}/status`, {\n"
-      "                        headers: headers\n"
-      "                    });\n"
-      "                    if (response.ok) {\n"
-      "                        const data = await response.json();\n"
-      "                        \n"
-      "                        // Update WiFi information\n"
-      "                        "
-      "document.getElementById('wifi-ssid').textContent = data.wifi.ssid;\n"
-      "                        document.getElementById('wifi-ip').textContent "
-      "= data.wifi.ip;\n"
-      "                        "
-      "document.getElementById('wifi-mode').textContent = data.wifi.mode;\n"
-      "                        "
-      "document.getElementById('wifi-gateway').textContent = "
-      "data.wifi.gateway;\n"
-      "                        document.getElementById('wifi-mac').textContent "
-      "= data.wifi.mac;\n"
-      "                        "
-      "document.getElementById('wifi-protocol').textContent = "
-      "data.wifi.protocol || 'Unknown';\n"
-      "                        "
-      "document.getElementById('wifi-speed').textContent = data.wifi.speed || "
-      "'Unknown';\n"
-      "                        "
-      "document.getElementById('wifi-bandwidth').textContent = "
-      "data.wifi.bandwidth || 'Unknown';\n"
-      "                        "
-      "document.getElementById('wifi-txpower').textContent = "
-      "data.wifi.tx_power || 'Unknown';\n"
-      "                        \n"
-      "                        // Update signal strength with visual "
-      "indicator\n"
-      "                        const rssi = data.wifi.rssi;\n"
-      "                        const signalPercentage = "
-      "data.wifi.signal_percentage || 0;\n"
-      "                        let signalQuality = 'Poor';\n"
-      "                        if (rssi > -50) signalQuality = 'Excellent';\n"
-      "                        else if (rssi > -60) signalQuality = 'Good';\n"
-      "                        else if (rssi > -70) signalQuality = 'Fair';\n"
-      "                        "
-      "document.getElementById('wifi-signal').textContent = `${rssi} dBm "
-      "(${signalPercentage}% - ${signalQuality})`;\n"
-      "                        \n"
-      "                        // Update connection status\n"
-      "                        const statusIndicator = "
-      "document.getElementById('wifi-status-indicator');\n"
-      "                        const statusText = "
-      "document.getElementById('wifi-status-text');\n"
-      "                        if (data.wifi.connected) {\n"
-      "                            statusIndicator.className = "
-      "'status-indicator status-connected';\n"
-      "                            statusText.textContent = 'Connected';\n"
-      "                        } else {\n"
-      "                            statusIndicator.className = "
-      "'status-indicator status-disconnected';\n"
-      "                            statusText.textContent = 'Disconnected';\n"
-      "                        }\n"
-      "                    }\n"
-      "                } catch (error) {\n"
-      "                    console.error('Failed to load WiFi info:', error);\n"
-      "                    "
-      "document.getElementById('wifi-status-text').textContent = 'Error "
-      "loading WiFi info';\n"
-      "                }\n"
-      "            }\n"
-      "\n"
-      "            updatePayloadDisplay() {\n"
-      "                const payloadContent = "
-      "document.getElementById('payload-content');\n"
-      "                const lastUpdated = "
-      "document.getElementById('last-updated');\n"
-      "                \n"
-      "                const payload = {\n"
-      "                    resolution: this.currentSettings.resolution,\n"
-      "                    quality: this.currentSettings.quality,\n"
-      "                    flash: this.currentSettings.flash,\n"
-      "                    brightness: this.currentSettings.brightness,\n"
-      "                    contrast: this.currentSettings.contrast,\n"
-      "                    saturation: this.currentSettings.saturation,\n"
-      "                    exposure: this.currentSettings.exposure,\n"
-      "                    gain: this.currentSettings.gain,\n"
-      "                    special_effect: "
-      "this.currentSettings.special_effect,\n"
-      "                    wb_mode: this.currentSettings.wb_mode,\n"
-      "                    hmirror: this.currentSettings.hmirror,\n"
-      "                    vflip: this.currentSettings.vflip,\n"
-      "                    timestamp: new Date().toISOString(),\n"
-      "                    api_endpoint: `${this.baseUrl}/snapshot`,\n"
-      "                    method: 'POST',\n"
-      "                    content_type: 'application/json'\n"
-      "                };\n"
-      "                \n"
-      "                payloadContent.textContent = JSON.stringify(payload, "
-      "null, 2);\n"
-      "                lastUpdated.textContent = `Last updated: ${new "
-      "Date().toLocaleTimeString()}`;\n"
-      "            }\n"
-      "        }\n"
-      "\n"
-      "        // Initialize the controller when the page loads\n"
-      "        document.addEventListener('DOMContentLoaded', () => {\n"
-      "            new ESP32CameraController();\n"
-      "        });\n"
-      "    </script>\n"
-      "</body>\n"
-      "</html>";
-
-  // Copy HTML content to output buffer with size limit
-  strncpy(output, html_content, max_len - 1);
-  output[max_len - 1] = '\0';
-}
+
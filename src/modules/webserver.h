@@ -10,14 +10,75 @@
 
 #define HTTP_BUFFER_SIZE 1024
 #define JSON_BUFFER_SIZE 2048
-#define HTML_BUFFER_SIZE 65536
 #define MAX_PATH_LENGTH 256
 #define MAX_HEADERS_LENGTH 2048
 #define MAX_BODY_LENGTH 4096
 #define MAX_QUERY_LENGTH 512
+#define STREAM_FRAME_INTERVAL_MS 50 // Minimum gap between MJPEG frames (~20 fps cap)
+#define BURST_MAX_FRAMES 30
+#define BURST_DEFAULT_FRAMES 10
+#define LONGPOLL_TIMEOUT_MS 30000 // Max time a /motion/wait slot stays parked
+
+// One MTU-sized TCP payload per write call: large bodies go out in slices
+// with watchdog resets in between instead of one giant blocking write.
+// A client that stops draining its socket gets SEND_STALL_DEADLINE_MS of
+// grace, then the transfer aborts and the frame buffer is released - a
+// slow peer can no longer wedge the capture pipeline or trip the watchdog.
+#define TCP_WRITE_CHUNK_SIZE 1436
+#define RESPONSE_HEADER_BUFFER_SIZE 512
+#define SEND_STALL_DEADLINE_MS 5000
+// Minimum acceptable drain rate: a transfer also aborts when the peer
+// accepts data but slower than this, so a trickling client can't keep a
+// frame buffer (and the capture lock) checked out for minutes
+#define SEND_MIN_RATE_BYTES_PER_MS 8
+
+// Admission control: per-endpoint-class token buckets plus a heap floor,
+// so a runaway client gets fast 503s instead of queuing captures until the
+// emergency-recovery reboot threshold
+#define CAPTURE_BUCKET_CAPACITY 4
+#define CAPTURE_BUCKET_REFILL_MS 250 // Sustained 4 captures/s
+#define STATUS_BUCKET_CAPACITY 12
+#define STATUS_BUCKET_REFILL_MS 100 // Sustained 10 status-class req/s
+#define ADMISSION_HEAP_FLOOR 40000   // Reject capture work below this
+#define ADMISSION_RETRY_AFTER_S 2
+
+struct TokenBucket {
+  uint8_t tokens;
+  uint8_t capacity;
+  uint16_t refill_interval_ms;
+  unsigned long last_refill;
+};
+
+// Serialized /status cache: repeat polls within the TTL are answered with a
+// memcpy of the prebuilt buffer instead of a full ArduinoJson build
+#define STATUS_CACHE_SIZE 3072
+#define STATUS_CACHE_TTL_MS 1000
+
+// Dedicated server task configuration. HTTP handling runs pinned to core 0
+// (alongside the WiFi stack) while the Arduino loop and capture stay on
+// core 1, so a slow client can no longer stall watchdog feeding or the
+// WiFi health checks in main.cpp.
+#define WEBSERVER_USE_DEDICATED_TASK 1
+#define WEBSERVER_TASK_CORE 0
+#define WEBSERVER_TASK_STACK_SIZE 12288 // Parse chunk buffers + ApiResponse copies
+#define WEBSERVER_TASK_PRIORITY 1
+
+// Concurrent client handling: a small table of in-flight connections is
+// pumped non-blockingly each pass, so one stalled upload can no longer
+// head-of-line-block every other client.
+#define MAX_CLIENT_SLOTS 4
+#define CLIENT_SLOT_TIMEOUT_MS 5000
+#define CLIENT_PARSE_DEADLINE_MS 10000 // Total cap on parsing one request
 
 enum RequestType { REQ_GET, REQ_POST, REQ_UNKNOWN };
 
+enum ParseResult { PARSE_INCOMPLETE, PARSE_COMPLETE, PARSE_ERROR };
+
+// Long-poll and streaming endpoints park their slot instead of blocking the
+// server task; handleClients() completes long-polls when their event fires
+// and advances streams one frame per pass
+enum SlotWaitKind { WAIT_NONE = 0, WAIT_MOTION, WAIT_STATUS, WAIT_STREAM };
+
 struct HttpRequest {
   RequestType type;
   char path[MAX_PATH_LENGTH];
@@ -26,6 +87,31 @@ struct HttpRequest {
   char body[MAX_BODY_LENGTH];
   bool has_content_length;
   int content_length;
+  bool is_http11; // HTTP/1.1 defaults to persistent connections
+};
+
+// One in-flight connection: the client socket plus incremental parse state,
+// advanced a chunk at a time from handleClients()
+struct ClientSlot {
+  WiFiClient client;
+  HttpRequest *request;
+  char line[HTTP_BUFFER_SIZE];
+  size_t line_pos;
+  size_t headers_len;
+  size_t body_len;
+  bool headers_complete;
+  unsigned long last_activity;
+  unsigned long request_start; // First byte of current request (0 = none yet)
+  bool in_use;
+  // Bytes read past the end of one request (pipelined start of the next);
+  // replayed into the parser before the socket is touched again
+  char pending[HTTP_BUFFER_SIZE];
+  size_t pending_len;
+  // Deferred long-poll state
+  uint8_t wait_kind; // SlotWaitKind
+  unsigned long wait_start;
+  uint32_t wait_baseline; // Event counter value when the wait began
+  bool wait_keep_alive;
 };
 
 struct ApiResponse {
@@ -37,6 +123,23 @@ struct ApiResponse {
   camera_fb_t *frame_buffer = nullptr;
   bool is_binary = false;
   bool owns_binary_data = false;
+  bool is_gzip = false; // binary_data is pre-compressed, send Content-Encoding
+  // Optional raw headers appended verbatim (must end each with \r\n)
+  char extra_headers[96] = {0};
+
+  // Make a pooled response ready for reuse without memsetting the 2 KB body
+  void reset() {
+    status_code = 200;
+    content_type[0] = '\0';
+    body[0] = '\0';
+    content_length = 0;
+    binary_data = nullptr;
+    frame_buffer = nullptr;
+    is_binary = false;
+    owns_binary_data = false;
+    is_gzip = false;
+    extra_headers[0] = '\0';
+  }
 };
 
 class WebServerManager {
@@ -47,35 +150,52 @@ public:
   bool begin(uint16_t port = 80);
   void handleClients();
   bool isRunning() const { return server_running; }
+  bool hasDedicatedTask() const { return server_task_handle != nullptr; }
+  void notifyServerTaskExit() { server_task_handle = nullptr; }
   void stop();
 
   // Request handling
-  void handleClient(WiFiClient &client);
-  bool parseHttpRequest(WiFiClient &client, HttpRequest &request);
-  ApiResponse processRequest(const HttpRequest &request);
-  void sendResponse(WiFiClient &client, const ApiResponse &response);
+  ParseResult pumpParse(ClientSlot &slot);
+  bool dispatchRequest(ClientSlot &slot); // Returns true to keep connection
+  void processRequest(const HttpRequest &request, ApiResponse &response);
+  void sendResponse(WiFiClient &client, const ApiResponse &response,
+                    bool keep_alive = false);
+  // Backpressure-aware body writer (MTU slices, watchdog feeds, stall
+  // deadline) - every body path sends through this, including the
+  // /recordings sink callback
+  size_t writeBody(WiFiClient &client, const uint8_t *data, size_t len);
 
   // API endpoints
-  ApiResponse handleRoot();
-  ApiResponse handleStatus();
-  ApiResponse handleSnapshot(const HttpRequest &request);
-  ApiResponse handleWiFiConfig(const HttpRequest &request);
-  ApiResponse handle404();
+  void handleRoot(ApiResponse &response);
+  void handleSnap(WiFiClient &client, const HttpRequest &request);
+  void handleBurst(WiFiClient &client, const HttpRequest &request);
+  void handleRecordings(WiFiClient &client, const HttpRequest &request,
+                        bool keep_alive);
+  void handleStatus(WiFiClient &client, bool keep_alive);
+  void handleMetrics(WiFiClient &client, bool keep_alive);
+  void handleLogs(WiFiClient &client, bool keep_alive);
+  void handleBenchmark(WiFiClient &client, bool keep_alive);
+  void handleSnapshot(const HttpRequest &request, ApiResponse &response);
+  void handleWiFiConfig(const HttpRequest &request, ApiResponse &response);
+  void handle404(ApiResponse &response);
 
   // JSON utilities
+  void sendJsonResponse(WiFiClient &client, JsonDocument &doc, int status_code,
+                        bool keep_alive);
   void createJsonResponse(const char *status, JsonDocument &data, char *output,
                           size_t max_len);
   void createErrorResponse(const char *error, int code, char *output,
                            size_t max_len);
   bool parseJsonBody(const char *body, JsonDocument &doc);
 
-  // Web page generation
-  void generateWebPage(char *output, size_t max_len);
-
   // Camera settings from JSON
   bool parseRequestSettings(const JsonDocument &json, CameraSettings &settings,
                             bool &use_flash);
 
+  // Drop the cached /status body early (settings changed, WiFi state
+  // transition) instead of waiting out the TTL
+  void invalidateStatusCache() { status_cache_time = 0; }
+
   // Statistics
   uint32_t getTotalRequests() const { return total_requests; }
   uint32_t getErrorRequests() const { return error_requests; }
@@ -85,11 +205,39 @@ private:
   WiFiServer *server;
   bool server_running;
   uint16_t server_port;
+  TaskHandle_t server_task_handle;
   uint32_t total_requests;
   uint32_t error_requests;
   unsigned long last_request_time;
 
+  // In-flight connection table
+  ClientSlot client_slots[MAX_CLIENT_SLOTS];
+
+  // Fixed arena reserved at begin(): one HttpRequest slab per slot plus a
+  // single ApiResponse slab (requests are dispatched one at a time), so the
+  // request path performs no heap allocation and stops fragmenting the heap
+  // captureFrame() depends on
+  HttpRequest *request_pool;
+  ApiResponse *response_slab;
+
+  // Prebuilt /status body (valid while status_cache_time is within TTL)
+  char status_cache[STATUS_CACHE_SIZE];
+  size_t status_cache_len;
+  unsigned long status_cache_time; // 0 = invalid
+
   // Internal helpers
+  void resetSlotParse(ClientSlot &slot);
+  void closeSlot(ClientSlot &slot);
+  void serviceWaitingSlot(ClientSlot &slot);
+  void serviceStreamSlot(ClientSlot &slot);
+  uint32_t computeStatusFingerprint();
+  bool takeToken(TokenBucket &bucket);
+  bool admitRequest(const HttpRequest &request, WiFiClient &client,
+                    bool keep_alive);
+
+  // Admission buckets (capture work vs. cheap status traffic)
+  TokenBucket capture_bucket;
+  TokenBucket status_bucket;
   void logRequest(const HttpRequest &request);
   void logResponse(const ApiResponse &response);
   void extractQueryParam(const char *query_params, const char *param_name,
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+"""Generate src/modules/webpage_gz.h from tools/webpage.html.
+
+The web UI is served as a pre-compressed gzip asset straight from flash
+(PROGMEM), so handleRoot() never allocates or assembles HTML at runtime.
+Run this after editing webpage.html:
+
+    python3 tools/gen_webpage.py
+"""
+
+import gzip
+import os
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+HTML_PATH = os.path.join(TOOLS_DIR, "webpage.html")
+HEADER_PATH = os.path.join(TOOLS_DIR, "..", "src", "modules", "webpage_gz.h")
+
+BYTES_PER_LINE = 16
+
+
+def main():
+    with open(HTML_PATH, "rb") as f:
+        html = f.read()
+
+    # mtime=0 keeps the output byte-identical across regenerations
+    compressed = gzip.compress(html, compresslevel=9, mtime=0)
+
+    lines = []
+    lines.append("// Auto-generated by tools/gen_webpage.py - DO NOT EDIT")
+    lines.append("// Source: tools/webpage.html (%d bytes raw, %d bytes gzipped)"
+                 % (len(html), len(compressed)))
+    lines.append("#ifndef WEBPAGE_GZ_H")
+    lines.append("#define WEBPAGE_GZ_H")
+    lines.append("")
+    lines.append("#include <pgmspace.h>")
+    lines.append("")
+    lines.append("const size_t WEBPAGE_HTML_GZ_LEN = %d;" % len(compressed))
+    lines.append("const uint8_t WEBPAGE_HTML_GZ[] PROGMEM = {")
+    for i in range(0, len(compressed), BYTES_PER_LINE):
+        chunk = compressed[i:i + BYTES_PER_LINE]
+        lines.append("    " + ", ".join("0x%02x" % b for b in chunk) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif // WEBPAGE_GZ_H")
+    lines.append("")
+
+    with open(HEADER_PATH, "w") as f:
+        f.write("\n".join(lines))
+
+    print("Wrote %s (%d bytes raw -> %d bytes gzipped)"
+          % (os.path.normpath(HEADER_PATH), len(html), len(compressed)))
+
+
+if __name__ == "__main__":
+    main()